@@ -0,0 +1,52 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+/**
+ * Bump-pointer memory arena for many small objects with a common lifetime.
+ */
+
+#include <libdevcore/Arena.h>
+
+#include <libdevcore/Assertions.h>
+
+#include <cstdint>
+
+using namespace std;
+using namespace dev;
+
+void* Arena::allocate(size_t _size, size_t _alignment)
+{
+	assertThrow(_alignment > 0 && (_alignment & (_alignment - 1)) == 0, Exception, "Invalid alignment.");
+	size_t padding = (_alignment - reinterpret_cast<uintptr_t>(m_current) % _alignment) % _alignment;
+	if (!m_current || padding + _size > m_remaining)
+	{
+		// Large objects get a block of their own, so that the rest
+		// of the current block is not wasted.
+		size_t blockSize = max(m_blockSize, _size + _alignment);
+		m_blocks.emplace_back(static_cast<char*>(::operator new(blockSize)));
+		m_reservedBytes += blockSize;
+		char* block = m_blocks.back().get();
+		padding = (_alignment - reinterpret_cast<uintptr_t>(block) % _alignment) % _alignment;
+		if (_size + _alignment > m_blockSize)
+			return block + padding;
+		m_current = block;
+		m_remaining = blockSize;
+	}
+	char* result = m_current + padding;
+	m_current += padding + _size;
+	m_remaining -= padding + _size;
+	return result;
+}
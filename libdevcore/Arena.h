@@ -0,0 +1,99 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+/**
+ * Bump-pointer memory arena for many small objects with a common lifetime.
+ */
+
+#pragma once
+
+#include <boost/noncopyable.hpp>
+
+#include <cstddef>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace dev
+{
+
+/**
+ * Memory arena that hands out memory from large blocks and frees
+ * all of it at once when it is destroyed.
+ * Destructors of objects created in the arena are not called automatically.
+ */
+class Arena: boost::noncopyable
+{
+public:
+	explicit Arena(size_t _blockSize = 64 * 1024): m_blockSize(_blockSize) {}
+
+	/// @returns a pointer to @a _size bytes of memory aligned to @a _alignment.
+	void* allocate(size_t _size, size_t _alignment = alignof(std::max_align_t));
+
+	/// Constructs an object of type T in the arena. The caller is responsible
+	/// for calling its destructor if it is not trivial.
+	template <class T, class... Args>
+	T* create(Args&&... _args)
+	{
+		return new (allocate(sizeof(T), alignof(T))) T(std::forward<Args>(_args)...);
+	}
+
+	/// @returns the total number of bytes reserved from the system.
+	size_t reservedBytes() const { return m_reservedBytes; }
+
+private:
+	struct BlockDeleter
+	{
+		void operator()(char* _block) const { ::operator delete(_block); }
+	};
+
+	size_t const m_blockSize;
+	std::vector<std::unique_ptr<char, BlockDeleter>> m_blocks;
+	char* m_current = nullptr;
+	size_t m_remaining = 0;
+	size_t m_reservedBytes = 0;
+};
+
+/**
+ * Standard allocator that allocates from an arena and never frees memory itself.
+ * It keeps the arena alive, so that containers and shared pointers
+ * created with it can outlive the other owners of the arena.
+ */
+template <class T>
+class ArenaAllocator
+{
+public:
+	using value_type = T;
+
+	explicit ArenaAllocator(std::shared_ptr<Arena> _arena): m_arena(std::move(_arena)) {}
+	template <class U>
+	ArenaAllocator(ArenaAllocator<U> const& _other): m_arena(_other.arena()) {}
+
+	T* allocate(size_t _n) { return static_cast<T*>(m_arena->allocate(_n * sizeof(T), alignof(T))); }
+	void deallocate(T*, size_t) {}
+
+	std::shared_ptr<Arena> const& arena() const { return m_arena; }
+
+	template <class U>
+	bool operator==(ArenaAllocator<U> const& _other) const { return m_arena == _other.arena(); }
+	template <class U>
+	bool operator!=(ArenaAllocator<U> const& _other) const { return m_arena != _other.arena(); }
+
+private:
+	std::shared_ptr<Arena> m_arena;
+};
+
+}
@@ -0,0 +1,333 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+/**
+ * Fixed-width 256 bit integer arithmetic for the evaluation of EVM instructions.
+ */
+
+#include <libdevcore/FixedU256.h>
+
+using namespace std;
+using namespace dev;
+
+namespace
+{
+
+using limb_type = boost::multiprecision::limb_type;
+static_assert(sizeof(limb_type) == 8 || sizeof(limb_type) == 4, "Unsupported limb size.");
+unsigned constexpr c_backendLimbsPerLimb = 8 / sizeof(limb_type);
+
+#if defined(__SIZEOF_INT128__)
+
+using uint128 = unsigned __int128;
+
+/// @returns the number of leading zero bits of the non-zero value @a _value.
+unsigned countLeadingZeros(uint64_t _value)
+{
+	unsigned count = 0;
+	for (uint64_t mask = uint64_t(1) << 63; !(_value & mask); mask >>= 1)
+		++count;
+	return count;
+}
+
+/// @returns the number of limbs without the leading zero limbs.
+size_t significantLimbs(uint64_t const* _limbs, size_t _size)
+{
+	while (_size > 0 && _limbs[_size - 1] == 0)
+		--_size;
+	return _size;
+}
+
+/// Unsigned long division of @a _dividend (@a _m limbs) by the non-zero @a _divisor
+/// (@a _n limbs, most significant limb non-zero, _n <= 4, _m <= 8) using Knuth's
+/// algorithm D. Stores the @a _m - @a _n + 1 quotient limbs in @a _quotient
+/// and the @a _n remainder limbs in @a _remainder.
+void longDivision(
+	uint64_t const* _dividend,
+	size_t _m,
+	uint64_t const* _divisor,
+	size_t _n,
+	uint64_t* _quotient,
+	uint64_t* _remainder
+)
+{
+	if (_n == 1)
+	{
+		uint128 remainder = 0;
+		for (size_t i = _m; i > 0; --i)
+		{
+			uint128 current = (remainder << 64) | _dividend[i - 1];
+			_quotient[i - 1] = uint64_t(current / _divisor[0]);
+			remainder = current % _divisor[0];
+		}
+		_remainder[0] = uint64_t(remainder);
+		return;
+	}
+
+	// Normalize so that the most significant bit of the divisor is set.
+	unsigned shift = countLeadingZeros(_divisor[_n - 1]);
+	uint64_t divisor[4];
+	uint64_t dividend[9];
+	for (size_t i = _n - 1; i > 0; --i)
+		divisor[i] = (_divisor[i] << shift) | (shift ? _divisor[i - 1] >> (64 - shift) : 0);
+	divisor[0] = _divisor[0] << shift;
+	dividend[_m] = shift ? _dividend[_m - 1] >> (64 - shift) : 0;
+	for (size_t i = _m - 1; i > 0; --i)
+		dividend[i] = (_dividend[i] << shift) | (shift ? _dividend[i - 1] >> (64 - shift) : 0);
+	dividend[0] = _dividend[0] << shift;
+
+	for (size_t j = _m - _n + 1; j > 0; --j)
+	{
+		size_t const k = j - 1;
+		uint128 numerator = (uint128(dividend[k + _n]) << 64) | dividend[k + _n - 1];
+		uint128 estimate = numerator / divisor[_n - 1];
+		uint128 estimateRemainder = numerator % divisor[_n - 1];
+		while (
+			(estimate >> 64) ||
+			estimate * divisor[_n - 2] > ((estimateRemainder << 64) | dividend[k + _n - 2])
+		)
+		{
+			--estimate;
+			estimateRemainder += divisor[_n - 1];
+			if (estimateRemainder >> 64)
+				break;
+		}
+
+		// Multiply and subtract.
+		uint64_t borrow = 0;
+		uint64_t carry = 0;
+		for (size_t i = 0; i < _n; ++i)
+		{
+			uint128 product = estimate * divisor[i] + carry;
+			carry = uint64_t(product >> 64);
+			uint64_t low = uint64_t(product);
+			uint64_t difference = dividend[i + k] - low;
+			uint64_t nextBorrow = dividend[i + k] < low;
+			dividend[i + k] = difference - borrow;
+			borrow = nextBorrow | (difference < borrow);
+		}
+		uint64_t top = dividend[k + _n];
+		dividend[k + _n] = top - carry - borrow;
+		bool negative = top < uint128(carry) + borrow;
+
+		if (negative)
+		{
+			// The estimate was one too large, add the divisor back.
+			--estimate;
+			uint64_t addCarry = 0;
+			for (size_t i = 0; i < _n; ++i)
+			{
+				uint128 sum = uint128(dividend[i + k]) + divisor[i] + addCarry;
+				dividend[i + k] = uint64_t(sum);
+				addCarry = uint64_t(sum >> 64);
+			}
+			dividend[k + _n] += addCarry;
+		}
+		_quotient[k] = uint64_t(estimate);
+	}
+
+	// Undo the normalization of the remainder.
+	for (size_t i = 0; i < _n; ++i)
+		_remainder[i] = (dividend[i] >> shift) | (shift ? dividend[i + 1] << (64 - shift) : 0);
+}
+
+/// Reduces the @a _size limbs of @a _value modulo the non-zero @a _modulus.
+FixedU256 reduce(uint64_t const* _value, size_t _size, FixedU256 const& _modulus)
+{
+	size_t n = significantLimbs(_modulus.limbs().data(), 4);
+	size_t m = significantLimbs(_value, _size);
+	FixedU256::Limbs remainder{{0, 0, 0, 0}};
+	if (m < n)
+		copy(_value, _value + m, remainder.begin());
+	else
+	{
+		uint64_t quotient[8];
+		longDivision(_value, m, _modulus.limbs().data(), n, quotient, remainder.data());
+	}
+	return FixedU256(remainder);
+}
+
+#endif
+
+}
+
+FixedU256::FixedU256(u256 const& _value): m_limbs{{0, 0, 0, 0}}
+{
+	auto const& backend = _value.backend();
+	for (unsigned i = 0; i < backend.size(); ++i)
+		m_limbs[i / c_backendLimbsPerLimb] |=
+			uint64_t(backend.limbs()[i]) << (sizeof(limb_type) * 8 * (i % c_backendLimbsPerLimb));
+}
+
+FixedU256::operator u256() const
+{
+	u256 result = m_limbs[3];
+	for (size_t i = 3; i > 0; --i)
+	{
+		result <<= 64;
+		result |= m_limbs[i - 1];
+	}
+	return result;
+}
+
+FixedU256 FixedU256::operator*(FixedU256 const& _other) const
+{
+#if defined(__SIZEOF_INT128__)
+	FixedU256 result;
+	for (size_t i = 0; i < 4; ++i)
+	{
+		uint64_t carry = 0;
+		for (size_t j = 0; i + j < 4; ++j)
+		{
+			uint128 product =
+				uint128(m_limbs[i]) * _other.m_limbs[j] + result.m_limbs[i + j] + carry;
+			result.m_limbs[i + j] = uint64_t(product);
+			carry = uint64_t(product >> 64);
+		}
+	}
+	return result;
+#else
+	return FixedU256(u256(*this) * u256(_other));
+#endif
+}
+
+FixedU256 FixedU256::operator/(FixedU256 const& _other) const
+{
+	return divMod(*this, _other).first;
+}
+
+FixedU256 FixedU256::operator%(FixedU256 const& _other) const
+{
+	return divMod(*this, _other).second;
+}
+
+pair<FixedU256, FixedU256> FixedU256::divMod(FixedU256 const& _dividend, FixedU256 const& _divisor)
+{
+	if (_divisor.isZero())
+		return {FixedU256(), FixedU256()};
+	if (_dividend < _divisor)
+		return {FixedU256(), _dividend};
+	if (_dividend.fitsUint64())
+		return {
+			FixedU256(_dividend.m_limbs[0] / _divisor.m_limbs[0]),
+			FixedU256(_dividend.m_limbs[0] % _divisor.m_limbs[0])
+		};
+#if defined(__SIZEOF_INT128__)
+	size_t n = significantLimbs(_divisor.m_limbs.data(), 4);
+	size_t m = significantLimbs(_dividend.m_limbs.data(), 4);
+	FixedU256 quotient;
+	FixedU256 remainder;
+	longDivision(
+		_dividend.m_limbs.data(),
+		m,
+		_divisor.m_limbs.data(),
+		n,
+		quotient.m_limbs.data(),
+		remainder.m_limbs.data()
+	);
+	return {quotient, remainder};
+#else
+	u256 dividend(_dividend);
+	u256 divisor(_divisor);
+	return {FixedU256(u256(dividend / divisor)), FixedU256(u256(dividend % divisor))};
+#endif
+}
+
+FixedU256 FixedU256::addMod(FixedU256 const& _a, FixedU256 const& _b, FixedU256 const& _modulus)
+{
+	if (_modulus.isZero())
+		return FixedU256();
+	FixedU256 sum = _a + _b;
+	if (!(sum < _a))
+		return sum % _modulus;
+#if defined(__SIZEOF_INT128__)
+	// The addition overflowed, reduce the 257 bit sum.
+	uint64_t wide[5] = {sum.m_limbs[0], sum.m_limbs[1], sum.m_limbs[2], sum.m_limbs[3], 1};
+	return reduce(wide, 5, _modulus);
+#else
+	return FixedU256(u256((bigint(u256(_a)) + u256(_b)) % u256(_modulus)));
+#endif
+}
+
+FixedU256 FixedU256::mulMod(FixedU256 const& _a, FixedU256 const& _b, FixedU256 const& _modulus)
+{
+	if (_modulus.isZero())
+		return FixedU256();
+#if defined(__SIZEOF_INT128__)
+	uint64_t product[8] = {0, 0, 0, 0, 0, 0, 0, 0};
+	for (size_t i = 0; i < 4; ++i)
+	{
+		uint64_t carry = 0;
+		for (size_t j = 0; j < 4; ++j)
+		{
+			uint128 partial = uint128(_a.m_limbs[i]) * _b.m_limbs[j] + product[i + j] + carry;
+			product[i + j] = uint64_t(partial);
+			carry = uint64_t(partial >> 64);
+		}
+		product[i + 4] = carry;
+	}
+	return reduce(product, 8, _modulus);
+#else
+	return FixedU256(u256((bigint(u256(_a)) * u256(_b)) % u256(_modulus)));
+#endif
+}
+
+FixedU256 FixedU256::exp(FixedU256 _base, FixedU256 const& _exponent)
+{
+	FixedU256 result(1);
+	for (unsigned i = 0; i < 256; ++i)
+	{
+		if (_exponent.bit(i))
+			result = result * _base;
+		if ((_exponent >> (i + 1)).isZero())
+			break;
+		_base = _base * _base;
+	}
+	return result;
+}
+
+FixedU256 FixedU256::signedDiv(FixedU256 const& _a, FixedU256 const& _b)
+{
+	if (_b.isZero())
+		return FixedU256();
+	FixedU256 quotient = divMod(_a.isNegative() ? -_a : _a, _b.isNegative() ? -_b : _b).first;
+	// Note that -2**255 / -1 wraps around to -2**255.
+	return _a.isNegative() != _b.isNegative() ? -quotient : quotient;
+}
+
+FixedU256 FixedU256::signedMod(FixedU256 const& _a, FixedU256 const& _b)
+{
+	if (_b.isZero())
+		return FixedU256();
+	FixedU256 remainder = divMod(_a.isNegative() ? -_a : _a, _b.isNegative() ? -_b : _b).second;
+	return _a.isNegative() ? -remainder : remainder;
+}
+
+bool FixedU256::signedLessThan(FixedU256 const& _a, FixedU256 const& _b)
+{
+	if (_a.isNegative() != _b.isNegative())
+		return _a.isNegative();
+	return _a < _b;
+}
+
+FixedU256 FixedU256::arithmeticShiftRight(FixedU256 const& _value, unsigned _amount)
+{
+	if (!_value.isNegative())
+		return _value >> _amount;
+	if (_amount >= 256)
+		return ~FixedU256();
+	return ~(~_value >> _amount);
+}
@@ -0,0 +1,205 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+/**
+ * Fixed-width 256 bit integer arithmetic for the evaluation of EVM instructions.
+ */
+
+#pragma once
+
+#include <libdevcore/Common.h>
+
+#include <array>
+#include <cstdint>
+
+namespace dev
+{
+
+/**
+ * Unsigned 256 bit integer stored as four 64 bit limbs, least significant limb first.
+ * All operations wrap around modulo 2**256 and never allocate.
+ * It is meant for the hot paths that evaluate EVM instructions on constants
+ * and is converted from and to u256 at the boundaries of those paths.
+ */
+class FixedU256
+{
+public:
+	using Limbs = std::array<uint64_t, 4>;
+
+	FixedU256(): m_limbs{{0, 0, 0, 0}} {}
+	FixedU256(uint64_t _value): m_limbs{{_value, 0, 0, 0}} {}
+	explicit FixedU256(Limbs const& _limbs): m_limbs(_limbs) {}
+	explicit FixedU256(u256 const& _value);
+
+	explicit operator u256() const;
+
+	Limbs const& limbs() const { return m_limbs; }
+	bool isZero() const { return !(m_limbs[0] | m_limbs[1] | m_limbs[2] | m_limbs[3]); }
+	/// @returns true if the most significant bit is set, i.e. the value is negative
+	/// in two's complement.
+	bool isNegative() const { return m_limbs[3] >> 63; }
+	bool bit(unsigned _index) const
+	{
+		return _index < 256 && ((m_limbs[_index / 64] >> (_index % 64)) & 1);
+	}
+	/// @returns true if the value fits into 64 bits.
+	bool fitsUint64() const { return !(m_limbs[1] | m_limbs[2] | m_limbs[3]); }
+
+	FixedU256 operator+(FixedU256 const& _other) const;
+	FixedU256 operator-(FixedU256 const& _other) const;
+	FixedU256 operator*(FixedU256 const& _other) const;
+	/// Unsigned division, the result for a zero divisor is zero (as in the EVM).
+	FixedU256 operator/(FixedU256 const& _other) const;
+	/// Unsigned modulo, the result for a zero divisor is zero (as in the EVM).
+	FixedU256 operator%(FixedU256 const& _other) const;
+	FixedU256 operator-() const { return FixedU256() - *this; }
+	FixedU256 operator~() const;
+	FixedU256 operator&(FixedU256 const& _other) const;
+	FixedU256 operator|(FixedU256 const& _other) const;
+	FixedU256 operator^(FixedU256 const& _other) const;
+	/// Shifts, the result for shift amounts of 256 or more is zero.
+	FixedU256 operator<<(unsigned _amount) const;
+	FixedU256 operator>>(unsigned _amount) const;
+
+	bool operator==(FixedU256 const& _other) const { return m_limbs == _other.m_limbs; }
+	bool operator!=(FixedU256 const& _other) const { return m_limbs != _other.m_limbs; }
+	bool operator<(FixedU256 const& _other) const;
+	bool operator>(FixedU256 const& _other) const { return _other < *this; }
+	bool operator<=(FixedU256 const& _other) const { return !(_other < *this); }
+	bool operator>=(FixedU256 const& _other) const { return !(*this < _other); }
+
+	/// @returns quotient and remainder of the unsigned division, both zero for a zero divisor.
+	static std::pair<FixedU256, FixedU256> divMod(
+		FixedU256 const& _dividend,
+		FixedU256 const& _divisor
+	);
+	/// @returns (_a + _b) % _modulus computed without overflow, zero for a zero modulus.
+	static FixedU256 addMod(FixedU256 const& _a, FixedU256 const& _b, FixedU256 const& _modulus);
+	/// @returns (_a * _b) % _modulus computed without overflow, zero for a zero modulus.
+	static FixedU256 mulMod(FixedU256 const& _a, FixedU256 const& _b, FixedU256 const& _modulus);
+	/// @returns _base ** _exponent modulo 2**256.
+	static FixedU256 exp(FixedU256 _base, FixedU256 const& _exponent);
+	/// Division and modulo of the two's complement signed values, rounding towards zero.
+	/// The results for a zero divisor are zero.
+	static FixedU256 signedDiv(FixedU256 const& _a, FixedU256 const& _b);
+	static FixedU256 signedMod(FixedU256 const& _a, FixedU256 const& _b);
+	/// Comparison of the two's complement signed values.
+	static bool signedLessThan(FixedU256 const& _a, FixedU256 const& _b);
+	/// Arithmetic shift to the right of the two's complement signed value.
+	static FixedU256 arithmeticShiftRight(FixedU256 const& _value, unsigned _amount);
+
+private:
+	Limbs m_limbs;
+};
+
+inline FixedU256 FixedU256::operator+(FixedU256 const& _other) const
+{
+	FixedU256 result;
+	uint64_t carry = 0;
+	for (size_t i = 0; i < 4; ++i)
+	{
+		uint64_t sum = m_limbs[i] + carry;
+		carry = sum < carry;
+		result.m_limbs[i] = sum + _other.m_limbs[i];
+		carry += result.m_limbs[i] < sum;
+	}
+	return result;
+}
+
+inline FixedU256 FixedU256::operator-(FixedU256 const& _other) const
+{
+	FixedU256 result;
+	uint64_t borrow = 0;
+	for (size_t i = 0; i < 4; ++i)
+	{
+		uint64_t difference = m_limbs[i] - _other.m_limbs[i];
+		uint64_t nextBorrow = m_limbs[i] < _other.m_limbs[i];
+		result.m_limbs[i] = difference - borrow;
+		borrow = nextBorrow | (difference < borrow);
+	}
+	return result;
+}
+
+inline FixedU256 FixedU256::operator~() const
+{
+	return FixedU256(Limbs{{~m_limbs[0], ~m_limbs[1], ~m_limbs[2], ~m_limbs[3]}});
+}
+
+inline FixedU256 FixedU256::operator&(FixedU256 const& _other) const
+{
+	Limbs const& o = _other.m_limbs;
+	return FixedU256(Limbs{{
+		m_limbs[0] & o[0], m_limbs[1] & o[1], m_limbs[2] & o[2], m_limbs[3] & o[3]
+	}});
+}
+
+inline FixedU256 FixedU256::operator|(FixedU256 const& _other) const
+{
+	Limbs const& o = _other.m_limbs;
+	return FixedU256(Limbs{{
+		m_limbs[0] | o[0], m_limbs[1] | o[1], m_limbs[2] | o[2], m_limbs[3] | o[3]
+	}});
+}
+
+inline FixedU256 FixedU256::operator^(FixedU256 const& _other) const
+{
+	Limbs const& o = _other.m_limbs;
+	return FixedU256(Limbs{{
+		m_limbs[0] ^ o[0], m_limbs[1] ^ o[1], m_limbs[2] ^ o[2], m_limbs[3] ^ o[3]
+	}});
+}
+
+inline FixedU256 FixedU256::operator<<(unsigned _amount) const
+{
+	FixedU256 result;
+	if (_amount >= 256)
+		return result;
+	unsigned limbShift = _amount / 64;
+	unsigned bitShift = _amount % 64;
+	for (unsigned i = 3; i + 1 > limbShift; --i)
+	{
+		result.m_limbs[i] = m_limbs[i - limbShift] << bitShift;
+		if (bitShift && i > limbShift)
+			result.m_limbs[i] |= m_limbs[i - limbShift - 1] >> (64 - bitShift);
+	}
+	return result;
+}
+
+inline FixedU256 FixedU256::operator>>(unsigned _amount) const
+{
+	FixedU256 result;
+	if (_amount >= 256)
+		return result;
+	unsigned limbShift = _amount / 64;
+	unsigned bitShift = _amount % 64;
+	for (unsigned i = 0; i + limbShift < 4; ++i)
+	{
+		result.m_limbs[i] = m_limbs[i + limbShift] >> bitShift;
+		if (bitShift && i + limbShift + 1 < 4)
+			result.m_limbs[i] |= m_limbs[i + limbShift + 1] << (64 - bitShift);
+	}
+	return result;
+}
+
+inline bool FixedU256::operator<(FixedU256 const& _other) const
+{
+	for (size_t i = 4; i > 0; --i)
+		if (m_limbs[i - 1] != _other.m_limbs[i - 1])
+			return m_limbs[i - 1] < _other.m_limbs[i - 1];
+	return false;
+}
+
+}
@@ -17,8 +17,14 @@
 
 #pragma once
 
+#include <libdevcore/Assertions.h>
+#include <libdevcore/Exceptions.h>
+
+#include <boost/optional.hpp>
+
 #include <map>
 #include <set>
+#include <vector>
 
 /**
  * Data structure that keeps track of values and keys of a mapping.
@@ -32,6 +38,7 @@ struct InvertibleMap
 
 	void set(K _key, V _value)
 	{
+		record(_key);
 		if (values.count(_key))
 			references[values[_key]].erase(_key);
 		values[_key] = _value;
@@ -40,6 +47,7 @@ struct InvertibleMap
 
 	void eraseKey(K _key)
 	{
+		record(_key);
 		if (values.count(_key))
 			references[values[_key]].erase(_key);
 		values.erase(_key);
@@ -49,17 +57,70 @@ struct InvertibleMap
 	{
 		if (references.count(_value))
 		{
-			for (V v: references[_value])
-				values.erase(v);
+			for (K k: references[_value])
+			{
+				record(k);
+				values.erase(k);
+			}
 			references.erase(_value);
 		}
 	}
 
 	void clear()
 	{
+		for (auto const& item: values)
+			record(item.first);
 		values.clear();
 		references.clear();
 	}
+
+	/// Starts recording the changes to the map, so that the previous values of the
+	/// keys changed from now on can be retrieved via changedSince without copying the map.
+	/// Checkpoints can be nested and have to be released in reverse order.
+	/// @returns an identifier of the checkpoint.
+	size_t checkpoint()
+	{
+		++m_checkpoints;
+		return m_journal.size();
+	}
+
+	/// @returns the keys changed since @a _checkpoint together with their values
+	/// at that point, or nothing if they did not have a value.
+	std::map<K, boost::optional<V>> changedSince(size_t _checkpoint) const
+	{
+		std::map<K, boost::optional<V>> changes;
+		// Only the first change of each key is relevant.
+		for (size_t i = _checkpoint; i < m_journal.size(); ++i)
+			changes.insert(m_journal[i]);
+		return changes;
+	}
+
+	/// Stops recording the changes for @a _checkpoint.
+	void releaseCheckpoint(size_t _checkpoint)
+	{
+		assertThrow(m_checkpoints > 0 && _checkpoint <= m_journal.size(), dev::Exception, "");
+		--m_checkpoints;
+		// Outer checkpoints still need the changes.
+		if (m_checkpoints == 0)
+			m_journal.clear();
+	}
+
+private:
+	/// Records the current value of @a _key before it is changed.
+	void record(K const& _key)
+	{
+		if (m_checkpoints == 0)
+			return;
+		auto it = values.find(_key);
+		if (it == values.end())
+			m_journal.emplace_back(_key, boost::none);
+		else
+			m_journal.emplace_back(_key, it->second);
+	}
+
+	/// Previous values of changed keys, in the order of the changes.
+	std::vector<std::pair<K, boost::optional<V>>> m_journal;
+	size_t m_checkpoints = 0;
 };
 
 template <class T>
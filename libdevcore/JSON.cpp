@@ -21,6 +21,7 @@
 
 #include <libdevcore/JSON.h>
 
+#include <libdevcore/Assertions.h>
 #include <libdevcore/CommonIO.h>
 
 #include <boost/algorithm/string/replace.hpp>
@@ -105,6 +106,119 @@ string jsonCompactPrint(Json::Value const& _input)
 	return print(_input, writerBuilder);
 }
 
+JsonObjectWriter::JsonObjectWriter(Json::Value& _target): m_target(&_target)
+{
+	discard();
+}
+
+JsonObjectWriter::JsonObjectWriter(ostream& _stream): m_stream(&_stream)
+{
+	discard();
+}
+
+void JsonObjectWriter::write(string const& _key, Json::Value _value)
+{
+	assertThrow(!m_levels.empty(), Exception, "Object already finished.");
+	createPendingObjects();
+	if (m_stream)
+	{
+		beginMember(_key);
+		*m_stream << jsonCompactPrint(_value);
+	}
+	else
+		(*m_levels.back().value)[_key] = std::move(_value);
+}
+
+void JsonObjectWriter::beginObject(string const& _key, bool _omitIfEmpty)
+{
+	assertThrow(!m_levels.empty(), Exception, "Object already finished.");
+	m_levels.emplace_back();
+	m_levels.back().key = _key;
+	m_levels.back().omitIfEmpty = _omitIfEmpty;
+}
+
+void JsonObjectWriter::endObject()
+{
+	assertThrow(m_levels.size() > 1, Exception, "No object to close.");
+	if (!m_levels.back().omitIfEmpty)
+		createPendingObjects();
+	if (m_stream && m_levels.back().created)
+		*m_stream << "}";
+	m_levels.pop_back();
+}
+
+void JsonObjectWriter::endObjects()
+{
+	while (m_levels.size() > 1)
+		endObject();
+}
+
+void JsonObjectWriter::finish()
+{
+	endObjects();
+	if (m_stream && !m_levels.empty())
+	{
+		startStream();
+		*m_stream << "}";
+	}
+	m_levels.clear();
+}
+
+bool JsonObjectWriter::discard()
+{
+	if (m_streamStarted)
+		return false;
+	m_levels.clear();
+	m_levels.emplace_back();
+	m_levels.back().created = true;
+	if (m_target)
+	{
+		*m_target = Json::objectValue;
+		m_levels.back().value = m_target;
+	}
+	return true;
+}
+
+void JsonObjectWriter::startStream()
+{
+	if (!m_streamStarted)
+	{
+		*m_stream << "{";
+		m_streamStarted = true;
+	}
+}
+
+void JsonObjectWriter::createPendingObjects()
+{
+	if (m_stream)
+		startStream();
+	for (size_t i = 1; i < m_levels.size(); ++i)
+		if (!m_levels[i].created)
+		{
+			Level& parent = m_levels[i - 1];
+			if (m_stream)
+			{
+				beginMember(m_levels[i].key);
+				*m_stream << "{";
+			}
+			else
+				m_levels[i].value = &((*parent.value)[m_levels[i].key] = Json::objectValue);
+			m_levels[i].created = true;
+		}
+}
+
+void JsonObjectWriter::beginMember(string const& _key)
+{
+	// The member belongs to the innermost object that has already been created.
+	auto level = m_levels.rbegin();
+	while (!level->created)
+		++level;
+	if (level->hasMembers)
+		*m_stream << ",";
+	level->hasMembers = true;
+	*m_stream << jsonCompactPrint(Json::Value(_key)) << ":";
+}
+
 bool jsonParseStrict(string const& _input, Json::Value& _json, string* _errs /* = nullptr */)
 {
 	static StrictModeCharReaderBuilder readerBuilder;
@@ -24,7 +24,11 @@
 
 #include <json/json.h>
 
+#include <boost/noncopyable.hpp>
+
+#include <ostream>
 #include <string>
+#include <vector>
 
 namespace dev {
 
@@ -34,6 +38,61 @@ std::string jsonPrettyPrint(Json::Value const& _input);
 /// Serialise the JSON object (@a _input) without indentation
 std::string jsonCompactPrint(Json::Value const& _input);
 
+/**
+ * Writer that composes a JSON object member by member, either into a Json::Value
+ * or directly to a stream in compact form. The latter avoids keeping large documents
+ * in memory as a whole. The streamed output is identical to jsonCompactPrint
+ * of the complete object if all members are written in lexicographical order.
+ */
+class JsonObjectWriter: boost::noncopyable
+{
+public:
+	/// Composes the object in @a _target.
+	explicit JsonObjectWriter(Json::Value& _target);
+	/// Writes the object to @a _stream. Nothing is written before the first member.
+	explicit JsonObjectWriter(std::ostream& _stream);
+
+	/// Sets the member @a _key of the innermost open object to @a _value.
+	void write(std::string const& _key, Json::Value _value);
+	/// Opens the object member @a _key, following members are written into it.
+	/// If @a _omitIfEmpty is true, the member is only created once something is
+	/// written into it.
+	void beginObject(std::string const& _key, bool _omitIfEmpty = false);
+	/// Closes the innermost object opened with beginObject.
+	void endObject();
+	/// Closes all objects opened with beginObject.
+	void endObjects();
+	/// Closes all open objects including the outermost one.
+	void finish();
+	/// Discards everything written so far and continues with an empty outermost object.
+	/// @returns false and does nothing if parts of the object have already been
+	/// written to the stream, since these cannot be taken back.
+	bool discard();
+
+private:
+	struct Level
+	{
+		std::string key;
+		bool omitIfEmpty = false;
+		bool created = false;
+		bool hasMembers = false;
+		Json::Value* value = nullptr;
+	};
+
+	/// Writes the start of the outermost object to the stream if that has not happened yet.
+	void startStream();
+	/// Creates all objects that have been opened but not been created yet.
+	void createPendingObjects();
+	/// Starts a new member @a _key in the innermost object.
+	void beginMember(std::string const& _key);
+
+	/// The object being composed if it is not written to a stream.
+	Json::Value* m_target = nullptr;
+	std::ostream* m_stream = nullptr;
+	bool m_streamStarted = false;
+	std::vector<Level> m_levels;
+};
+
 /// Parse a JSON string (@a _input) with enabled strict-mode and writes resulting JSON object to (@a _json)
 /// \param _input JSON input string
 /// \param _json [out] resulting JSON object
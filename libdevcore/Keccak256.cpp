@@ -25,6 +25,7 @@
 #include <cstdio>
 #include <cstdlib>
 #include <cstring>
+#include <map>
 
 using namespace std;
 using namespace dev;
@@ -170,17 +171,165 @@ inline void hash(
 	memset(a, 0, 200);
 }
 
+// The 0x01 is the specific padding for keccak (sha3 uses 0x06) and
+// 200 - (256 / 4) is the rate for 256 bit output.
+size_t constexpr c_rate = 200 - (256 / 4);
+uint8_t constexpr c_delimiter = 0x01;
+
+#if defined(__GNUC__)
+
+/******** Keccak-f[1600] on several independent states at once. ********/
+
+size_t constexpr c_lanes = 4;
+/// Four 64 bit words, one per lane. Compiles to AVX2 instructions where enabled
+/// and is split into narrower vectors or scalars otherwise.
+typedef uint64_t KeccakLanes __attribute__((vector_size(8 * c_lanes)));
+
+#define rolLanes(x, s) (((x) << (s)) | ((x) >> (64 - (s))))
+
+/// The same permutation as keccakf, where every word of the state is a vector of lanes.
+static inline __attribute__((always_inline)) void keccakfLanes(KeccakLanes* a)
+{
+	KeccakLanes b[5] = {};
+
+	for (int i = 0; i < 24; i++)
+	{
+		uint8_t x, y;
+		// Theta
+		FOR5(x, 1,
+			b[x] = KeccakLanes{};
+			FOR5(y, 5,
+				b[x] ^= a[x + y]; ))
+		FOR5(x, 1,
+			FOR5(y, 5,
+				a[y + x] ^= b[(x + 4) % 5] ^ rolLanes(b[(x + 1) % 5], 1); ))
+		// Rho and pi
+		KeccakLanes t = a[1];
+		x = 0;
+		REPEAT24(b[0] = a[pi[x]];
+				a[pi[x]] = rolLanes(t, rho[x]);
+				t = b[0];
+				x++; )
+		// Chi
+		FOR5(y,
+			5,
+			FOR5(x, 1,
+				b[x] = a[y + x];)
+			FOR5(x, 1,
+				a[y + x] = b[x] ^ ((~b[(x + 1) % 5]) & b[(x + 2) % 5]); ))
+		// Iota
+		a[0] ^= RC[i];
+	}
+}
+
+void keccakfLanesDefault(KeccakLanes* _state)
+{
+	keccakfLanes(_state);
+}
+
+#if defined(__x86_64__) || defined(__i386__)
+__attribute__((target("avx2"))) void keccakfLanesAVX2(KeccakLanes* _state)
+{
+	keccakfLanes(_state);
+}
+#endif
+
+void permuteLanes(KeccakLanes* _state)
+{
+#if defined(__x86_64__) || defined(__i386__)
+	static bool const hasAVX2 = __builtin_cpu_supports("avx2");
+	if (hasAVX2)
+	{
+		keccakfLanesAVX2(_state);
+		return;
+	}
+#endif
+	keccakfLanesDefault(_state);
+}
+
+/// Xors the block @a _block of length c_rate into the lane @a _lane of the state.
+void absorbLane(KeccakLanes* _state, size_t _lane, uint8_t const* _block)
+{
+	for (size_t i = 0; i < c_rate / 8; ++i)
+	{
+		uint64_t word;
+		memcpy(&word, _block + 8 * i, 8);
+		_state[i][_lane] ^= word;
+	}
+}
+
+/// Hashes c_lanes inputs which all consist of the same number of full blocks.
+void hashLanes(bytesConstRef const* _inputs, h256* const* _outputs)
+{
+	KeccakLanes state[25] = {};
+	size_t const fullBlocks = _inputs[0].size() / c_rate;
+	for (size_t block = 0; block < fullBlocks; ++block)
+	{
+		for (size_t lane = 0; lane < c_lanes; ++lane)
+			absorbLane(state, lane, _inputs[lane].data() + block * c_rate);
+		permuteLanes(state);
+	}
+	for (size_t lane = 0; lane < c_lanes; ++lane)
+	{
+		uint8_t lastBlock[c_rate] = {0};
+		size_t remaining = _inputs[lane].size() - fullBlocks * c_rate;
+		if (remaining > 0)
+			memcpy(lastBlock, _inputs[lane].data() + fullBlocks * c_rate, remaining);
+		lastBlock[remaining] ^= c_delimiter;
+		lastBlock[c_rate - 1] ^= 0x80;
+		absorbLane(state, lane, lastBlock);
+	}
+	permuteLanes(state);
+	for (size_t lane = 0; lane < c_lanes; ++lane)
+		for (size_t i = 0; i < 4; ++i)
+		{
+			uint64_t word = state[i][lane];
+			memcpy(_outputs[lane]->data() + 8 * i, &word, 8);
+		}
+}
+
+#endif
+
 }
 
 h256 keccak256(bytesConstRef _input)
 {
 	h256 output;
-	// Parameters used:
-	// The 0x01 is the specific padding for keccak (sha3 uses 0x06) and
-	// the way the round size (or window or whatever it was) is calculated.
-	// 200 - (256 / 4) is the "rate"
-	hash(output.data(), output.size, _input.data(), _input.size(), 200 - (256 / 4), 0x01);
+	hash(output.data(), output.size, _input.data(), _input.size(), c_rate, c_delimiter);
 	return output;
 }
 
+vector<h256> keccak256Batch(vector<bytesConstRef> const& _inputs)
+{
+	vector<h256> outputs(_inputs.size());
+#if defined(__GNUC__)
+	// Inputs with the same number of blocks are hashed together, the rest one at a time.
+	map<size_t, vector<size_t>> inputsByBlocks;
+	for (size_t i = 0; i < _inputs.size(); ++i)
+		inputsByBlocks[_inputs[i].size() / c_rate].push_back(i);
+	for (auto const& blocksAndInputs: inputsByBlocks)
+	{
+		vector<size_t> const& indices = blocksAndInputs.second;
+		size_t i = 0;
+		for (; i + c_lanes <= indices.size(); i += c_lanes)
+		{
+			bytesConstRef inputs[c_lanes];
+			h256* laneOutputs[c_lanes];
+			for (size_t lane = 0; lane < c_lanes; ++lane)
+			{
+				inputs[lane] = _inputs[indices[i + lane]];
+				laneOutputs[lane] = &outputs[indices[i + lane]];
+			}
+			hashLanes(inputs, laneOutputs);
+		}
+		for (; i < indices.size(); ++i)
+			outputs[indices[i]] = keccak256(_inputs[indices[i]]);
+	}
+#else
+	for (size_t i = 0; i < _inputs.size(); ++i)
+		outputs[i] = keccak256(_inputs[i]);
+#endif
+	return outputs;
+}
+
 }
@@ -26,6 +26,7 @@
 #include <libdevcore/FixedHash.h>
 
 #include <string>
+#include <vector>
 
 namespace dev
 {
@@ -33,6 +34,10 @@ namespace dev
 /// Calculate Keccak-256 hash of the given input, returning as a 256-bit hash.
 h256 keccak256(bytesConstRef _input);
 
+/// Calculate the Keccak-256 hashes of all the given inputs. Inputs are hashed in
+/// parallel lanes using vector instructions where available.
+std::vector<h256> keccak256Batch(std::vector<bytesConstRef> const& _inputs);
+
 /// Calculate Keccak-256 hash of the given input, returning as a 256-bit hash.
 inline h256 keccak256(bytes const& _input) { return keccak256(bytesConstRef(&_input)); }
 
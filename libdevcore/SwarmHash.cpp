@@ -61,16 +61,42 @@ h256 swarmHashIntermediate(string const& _input, size_t _offset, size_t _length)
 	return swarmHashSimple(ref, _length);
 }
 
-h256 bmtHash(bytesConstRef _data)
+/// @returns the hashes of chunks with the given contents (of at most 0x1000 bytes each)
+/// and the given sizes of the data they represent.
+/// The binary merkle trees of all chunks are hashed together, one level at a time.
+vector<h256> chunkHashes(vector<pair<bytesConstRef, size_t>> const& _chunks)
 {
-	if (_data.size() <= 64)
-		return keccak256(_data);
-
-	size_t midPoint = _data.size() / 2;
-	return keccak256(
-		bmtHash(_data.cropped(0, midPoint)).asBytes() +
-		bmtHash(_data.cropped(midPoint)).asBytes()
-	);
+	if (_chunks.empty())
+		return {};
+
+	bytes level(_chunks.size() * 0x1000, 0);
+	for (size_t i = 0; i < _chunks.size(); ++i)
+		copy(_chunks[i].first.begin(), _chunks[i].first.end(), level.begin() + i * 0x1000);
+
+	// Every chunk has 0x1000 / 64 segments, which is a power of two, so the pairs
+	// of each level never cross the boundary between two chunks.
+	vector<bytesConstRef> segments;
+	vector<h256> hashes;
+	while (true)
+	{
+		segments.clear();
+		for (size_t i = 0; i < level.size(); i += 64)
+			segments.push_back(bytesConstRef(&level).cropped(i, 64));
+		hashes = keccak256Batch(segments);
+		if (hashes.size() == _chunks.size())
+			break;
+		level.clear();
+		for (h256 const& hash: hashes)
+			level += hash.asBytes();
+	}
+
+	vector<bytes> spans;
+	for (size_t i = 0; i < _chunks.size(); ++i)
+		spans.emplace_back(toLittleEndian(_chunks[i].second) + hashes[i].asBytes());
+	segments.clear();
+	for (bytes const& span: spans)
+		segments.emplace_back(&span);
+	return keccak256Batch(segments);
 }
 
 h256 chunkHash(bytesConstRef const _data, bool _forceHigherLevel = false)
@@ -88,18 +114,29 @@ h256 chunkHash(bytesConstRef const _data, bool _forceHigherLevel = false)
 		// If remaining size is 0x1000, but maxRepresentedSize is not,
 		// we have to still do one level of the chunk hashes.
 		bool forceHigher = maxRepresentedSize > 0x1000;
-		for (size_t i = 0; i < _data.size(); i += maxRepresentedSize)
+		if (forceHigher)
+			for (size_t i = 0; i < _data.size(); i += maxRepresentedSize)
+			{
+				size_t size = std::min(maxRepresentedSize, _data.size() - i);
+				dataToHash += chunkHash(_data.cropped(i, size), forceHigher).asBytes();
+			}
+		else
 		{
-			size_t size = std::min(maxRepresentedSize, _data.size() - i);
-			dataToHash += chunkHash(_data.cropped(i, size), forceHigher).asBytes();
+			// All children are data chunks, hash them at once.
+			vector<pair<bytesConstRef, size_t>> children;
+			for (size_t i = 0; i < _data.size(); i += maxRepresentedSize)
+			{
+				size_t size = std::min(maxRepresentedSize, _data.size() - i);
+				children.emplace_back(_data.cropped(i, size), size);
+			}
+			for (h256 const& hash: chunkHashes(children))
+				dataToHash += hash.asBytes();
 		}
 	}
 
-	dataToHash.resize(0x1000, 0);
-	return keccak256(toLittleEndian(_data.size()) + bmtHash(&dataToHash).asBytes());
+	return chunkHashes({{bytesConstRef(&dataToHash), _data.size()}}).front();
 }
 
-
 }
 
 h256 dev::bzzr0Hash(string const& _input)
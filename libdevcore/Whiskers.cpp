@@ -25,11 +25,77 @@
 
 #include <libdevcore/Assertions.h>
 
-#include <boost/regex.hpp>
+#include <mutex>
+#include <unordered_map>
 
 using namespace std;
 using namespace dev;
 
+/// A sequence of text and parameters, parsed from a range of the template text.
+struct Whiskers::Section
+{
+	struct Element
+	{
+		enum class Kind { Text, Tag, List, Condition };
+		Kind kind;
+		/// Range of the template text for text elements.
+		size_t begin;
+		size_t end;
+		/// Name of the tag, list or condition parameter.
+		string name;
+		/// The body of a list or the parts of a condition for true and for false.
+		vector<Section> sections;
+	};
+
+	/// Range of the template text this section was parsed from.
+	size_t begin;
+	size_t end;
+	vector<Element> elements;
+};
+
+struct Whiskers::RenderContext
+{
+	string const& text;
+	StringMap const& parameters;
+	/// Parameters of the current list element, if inside a list.
+	StringMap const* listElement;
+	map<string, bool> const& conditions;
+	/// List parameters, which are not available inside lists.
+	StringListMap const* listParameters;
+};
+
+namespace
+{
+
+bool isParameterCharacter(char _c)
+{
+	return
+		('a' <= _c && _c <= 'z') ||
+		('A' <= _c && _c <= 'Z') ||
+		('0' <= _c && _c <= '9') ||
+		_c == '_' || _c == '$' || _c == '-';
+}
+
+/// @returns the end of the parameter name starting at @a _pos.
+size_t parameterEnd(string const& _text, size_t _pos, size_t _end)
+{
+	while (_pos < _end && isParameterCharacter(_text[_pos]))
+		++_pos;
+	return _pos;
+}
+
+/// @returns the position of the first occurrence of @a _needle in the range
+/// from @a _begin to @a _end of @a _text or string::npos if there is none.
+size_t find(string const& _text, string const& _needle, size_t _begin, size_t _end)
+{
+	size_t pos = _text.find(_needle, _begin);
+	if (pos == string::npos || pos + _needle.size() > _end)
+		return string::npos;
+	return pos;
+}
+
+}
+
 Whiskers::Whiskers(string _template):
 	m_template(move(_template))
 {
@@ -67,14 +133,17 @@ Whiskers& Whiskers::operator()(
 
 string Whiskers::render() const
 {
-	return replace(m_template, m_parameters, m_conditions, m_listParameters);
+	shared_ptr<Section const> section = parse(m_template);
+	string result;
+	result.reserve(m_template.size());
+	render(*section, RenderContext{m_template, m_parameters, nullptr, m_conditions, &m_listParameters}, result);
+	return result;
 }
 
 void Whiskers::checkParameterValid(string const& _parameter) const
 {
-	static boost::regex validParam("^" + paramRegex() + "$");
 	assertThrow(
-		boost::regex_match(_parameter, validParam),
+		!_parameter.empty() && parameterEnd(_parameter, 0, _parameter.size()) == _parameter.size(),
 		WhiskersError,
 		"Parameter" + _parameter + " contains invalid characters."
 	);
@@ -99,72 +168,136 @@ void Whiskers::checkParameterUnknown(string const& _parameter) const
 	);
 }
 
-string Whiskers::replace(
-	string const& _template,
-	StringMap const& _parameters,
-	map<string, bool> const& _conditions,
-	map<string, vector<StringMap>> const& _listParameters
-)
+shared_ptr<Whiskers::Section const> Whiskers::parse(string const& _template)
 {
-	using namespace boost;
-	static regex listOrTag("<(" + paramRegex() + ")>|<#(" + paramRegex() + ")>(.*?)</\\2>|<\\?(" + paramRegex() + ")>(.*?)(<!\\4>(.*?))?</\\4>");
-	return regex_replace(_template, listOrTag, [&](match_results<string::const_iterator> _match) -> string
-	{
-		string tagName(_match[1]);
-		string listName(_match[2]);
-		string conditionName(_match[4]);
-		if (!tagName.empty())
+	// Templates are usually string constants, so the number of distinct
+	// templates is small. The limit only protects against unbounded growth.
+	static size_t const c_maxCachedTemplates = 4096;
+	static mutex cacheMutex;
+	static unordered_map<string, shared_ptr<Section const>> cache;
+
+	lock_guard<mutex> lock(cacheMutex);
+	auto it = cache.find(_template);
+	if (it != cache.end())
+		return it->second;
+	if (cache.size() >= c_maxCachedTemplates)
+		cache.clear();
+	auto section = make_shared<Section const>(parseSection(_template, 0, _template.size()));
+	cache.emplace(_template, section);
+	return section;
+}
+
+void Whiskers::render(Section const& _section, RenderContext const& _context, string& _output)
+{
+	for (Section::Element const& element: _section.elements)
+		switch (element.kind)
 		{
+		case Section::Element::Kind::Text:
+			_output.append(_context.text, element.begin, element.end - element.begin);
+			break;
+		case Section::Element::Kind::Tag:
+		{
+			if (_context.listElement)
+			{
+				auto it = _context.listElement->find(element.name);
+				if (it != _context.listElement->end())
+				{
+					_output += it->second;
+					break;
+				}
+			}
+			auto it = _context.parameters.find(element.name);
 			assertThrow(
-				_parameters.count(tagName),
+				it != _context.parameters.end(),
 				WhiskersError,
-				"Value for tag " + tagName + " not provided.\n" +
+				"Value for tag " + element.name + " not provided.\n" +
 				"Template:\n" +
-				_template
+				_context.text.substr(_section.begin, _section.end - _section.begin)
 			);
-			return _parameters.at(tagName);
+			_output += it->second;
+			break;
 		}
-		else if (!listName.empty())
+		case Section::Element::Kind::List:
 		{
-			string templ(_match[3]);
 			assertThrow(
-				_listParameters.count(listName),
-				WhiskersError, "List parameter " + listName + " not set."
+				_context.listParameters && _context.listParameters->count(element.name),
+				WhiskersError, "List parameter " + element.name + " not set."
 			);
-			string replacement;
-			for (auto const& parameters: _listParameters.at(listName))
-				replacement += replace(templ, joinMaps(_parameters, parameters), _conditions);
-			return replacement;
+			for (StringMap const& listElement: _context.listParameters->at(element.name))
+			{
+				for (auto const& parameter: listElement)
+					assertThrow(
+						!_context.parameters.count(parameter.first),
+						WhiskersError,
+						"Parameter collision"
+					);
+				RenderContext context{_context.text, _context.parameters, &listElement, _context.conditions, nullptr};
+				render(element.sections.front(), context, _output);
+			}
+			break;
 		}
-		else
-		{
-			assertThrow(!conditionName.empty(), WhiskersError, "");
+		case Section::Element::Kind::Condition:
 			assertThrow(
-				_conditions.count(conditionName),
-				WhiskersError, "Condition parameter " + conditionName + " not set."
-			);
-			return replace(
-				_conditions.at(conditionName) ? _match[5] : _match[7],
-				_parameters,
-				_conditions,
-				_listParameters
+				_context.conditions.count(element.name),
+				WhiskersError, "Condition parameter " + element.name + " not set."
 			);
+			render(element.sections.at(_context.conditions.at(element.name) ? 0 : 1), _context, _output);
+			break;
 		}
-	});
 }
 
-Whiskers::StringMap Whiskers::joinMaps(
-	Whiskers::StringMap const& _a,
-	Whiskers::StringMap const& _b
-)
+Whiskers::Section Whiskers::parseSection(string const& _text, size_t _begin, size_t _end)
 {
-	Whiskers::StringMap ret = _a;
-	for (auto const& x: _b)
-		assertThrow(
-			ret.insert(x).second,
-			WhiskersError,
-			"Parameter collision"
-		);
-	return ret;
+	using Element = Section::Element;
+	Section section{_begin, _end, {}};
+	size_t textBegin = _begin;
+	for (size_t pos = _text.find('<', _begin); pos < _end; pos = _text.find('<', pos + 1))
+	{
+		Element element{Element::Kind::Tag, 0, 0, {}, {}};
+		size_t nameBegin = pos + 1;
+		if (nameBegin < _end && (_text[nameBegin] == '#' || _text[nameBegin] == '?'))
+		{
+			element.kind = _text[nameBegin] == '#' ? Element::Kind::List : Element::Kind::Condition;
+			++nameBegin;
+		}
+		size_t nameEnd = parameterEnd(_text, nameBegin, _end);
+		if (nameEnd == nameBegin || nameEnd == _end || _text[nameEnd] != '>')
+			continue;
+		element.name = _text.substr(nameBegin, nameEnd - nameBegin);
+		size_t elementEnd = nameEnd + 1;
+		if (element.kind != Element::Kind::Tag)
+		{
+			string closingTag = "</" + element.name + ">";
+			size_t bodyBegin = elementEnd;
+			size_t bodyEnd = find(_text, closingTag, bodyBegin, _end);
+			if (bodyEnd == string::npos)
+				continue;
+			elementEnd = bodyEnd + closingTag.size();
+			if (element.kind == Element::Kind::List)
+				element.sections.emplace_back(parseSection(_text, bodyBegin, bodyEnd));
+			else
+			{
+				string elseTag = "<!" + element.name + ">";
+				size_t elsePos = find(_text, elseTag, bodyBegin, bodyEnd);
+				if (elsePos == string::npos)
+				{
+					element.sections.emplace_back(parseSection(_text, bodyBegin, bodyEnd));
+					element.sections.emplace_back(parseSection(_text, bodyEnd, bodyEnd));
+				}
+				else
+				{
+					element.sections.emplace_back(parseSection(_text, bodyBegin, elsePos));
+					element.sections.emplace_back(parseSection(_text, elsePos + elseTag.size(), bodyEnd));
+				}
+			}
+		}
+		if (textBegin < pos)
+			section.elements.emplace_back(Element{Element::Kind::Text, textBegin, pos, {}, {}});
+		section.elements.emplace_back(move(element));
+		textBegin = elementEnd;
+		pos = elementEnd - 1;
+	}
+	if (textBegin < _end)
+		section.elements.emplace_back(Element{Element::Kind::Text, textBegin, _end, {}, {}});
+	return section;
 }
-
@@ -25,8 +25,9 @@
 
 #include <libdevcore/Exceptions.h>
 
-#include <string>
 #include <map>
+#include <memory>
+#include <string>
 #include <vector>
 
 namespace dev
@@ -82,25 +83,27 @@ public:
 		std::vector<StringMap> _values
 	);
 
+	/// Renders the template. Templates are parsed only once per template text
+	/// and rendering is a single pass over the parsed template.
 	std::string render() const;
 
 private:
+	struct Section;
+	struct RenderContext;
+
 	// Prevent implicit cast to bool
 	Whiskers& operator()(std::string _parameter, long long);
 	void checkParameterValid(std::string const& _parameter) const;
 	void checkParameterUnknown(std::string const& _parameter) const;
 
-	static std::string replace(
-		std::string const& _template,
-		StringMap const& _parameters,
-		std::map<std::string, bool> const& _conditions,
-		StringListMap const& _listParameters = StringListMap()
-	);
-
-	static std::string paramRegex() { return "[a-zA-Z0-9_$-]+"; }
-
-	/// Joins the two maps throwing an exception if two keys are equal.
-	static StringMap joinMaps(StringMap const& _a, StringMap const& _b);
+	/// @returns the parsed form of the given template text, shared between
+	/// all templates with the same text.
+	static std::shared_ptr<Section const> parse(std::string const& _template);
+	/// Parses the range from @a _begin to @a _end of @a _text. Lists and conditions end at the
+	/// first closing tag of the same name and elements that are not closed are treated as text.
+	static Section parseSection(std::string const& _text, size_t _begin, size_t _end);
+	/// Appends the rendered section to @a _output.
+	static void render(Section const& _section, RenderContext const& _context, std::string& _output);
 
 	std::string m_template;
 	StringMap m_parameters;
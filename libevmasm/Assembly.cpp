@@ -68,6 +68,7 @@ void Assembly::append(Assembly const& _a)
 	m_subs += _a.m_subs;
 	for (auto const& lib: _a.m_libraries)
 		m_libraries.insert(lib);
+	++m_modificationCount;
 }
 
 void Assembly::append(Assembly const& _a, int _deposit)
@@ -84,6 +85,7 @@ AssemblyItem const& Assembly::append(AssemblyItem const& _i)
 	assertThrow(m_deposit >= 0, AssemblyException, "Stack underflow.");
 	m_deposit += _i.deposit();
 	m_items.emplace_back(_i);
+	++m_modificationCount;
 	if (m_items.back().location().isEmpty() && !m_currentSourceLocation.isEmpty())
 		m_items.back().setLocation(m_currentSourceLocation);
 	return back();
@@ -92,6 +94,53 @@ AssemblyItem const& Assembly::append(AssemblyItem const& _i)
 void Assembly::injectStart(AssemblyItem const& _i)
 {
 	m_items.insert(m_items.begin(), _i);
+	++m_modificationCount;
+}
+
+AssemblyItem Assembly::newSub(AssemblyPointer const& _sub)
+{
+	// Empty assemblies are usually still being built (like the runtime code during the
+	// creation of the context), so they are only re-used if they are the same object.
+	for (size_t subId = 0; subId < m_subs.size(); ++subId)
+		if (m_subs[subId] == _sub || (!_sub->m_items.empty() && m_subs[subId]->hasSameContent(*_sub)))
+			return AssemblyItem(PushSub, subId);
+	m_subs.push_back(_sub);
+	++m_modificationCount;
+	return AssemblyItem(PushSub, m_subs.size() - 1);
+}
+
+bool Assembly::hasSameContent(Assembly const& _other) const
+{
+	if (
+		m_items.size() != _other.m_items.size() ||
+		m_subs.size() != _other.m_subs.size() ||
+		m_data != _other.m_data ||
+		m_auxiliaryData != _other.m_auxiliaryData ||
+		m_strings != _other.m_strings ||
+		m_libraries != _other.m_libraries
+	)
+		return false;
+	// AssemblyItem::operator== ignores the source location and jump type, but they
+	// end up in the source mappings.
+	for (size_t i = 0; i < m_items.size(); ++i)
+		if (
+			m_items[i] != _other.m_items[i] ||
+			m_items[i].location() != _other.m_items[i].location() ||
+			m_items[i].getJumpType() != _other.m_items[i].getJumpType()
+		)
+			return false;
+	for (size_t subId = 0; subId < m_subs.size(); ++subId)
+		if (m_subs[subId] != _other.m_subs[subId] && !m_subs[subId]->hasSameContent(*_other.m_subs[subId]))
+			return false;
+	return true;
+}
+
+size_t Assembly::totalModificationCount() const
+{
+	size_t count = m_modificationCount;
+	for (auto const& sub: m_subs)
+		count += sub->totalModificationCount();
+	return count;
 }
 
 unsigned Assembly::bytesRequired(unsigned subTagSize) const
@@ -360,6 +409,7 @@ AssemblyItem Assembly::newPushLibraryAddress(string const& _identifier)
 {
 	h256 h(dev::keccak256(_identifier));
 	m_libraries[h] = _identifier;
+	++m_modificationCount;
 	return AssemblyItem{PushLibraryAddress, h};
 }
 
@@ -393,6 +443,17 @@ map<u256, u256> Assembly::optimiseInternal(
 	std::set<size_t> _tagsReferencedFromOutside
 )
 {
+	// Sub-assemblies shared by several super-assemblies (e.g. a contract that is created
+	// by several other contracts) only have to be optimised once.
+	if (
+		m_lastOptimisation &&
+		m_lastOptimisation->modificationCount == totalModificationCount() &&
+		m_lastOptimisation->settings == _settings &&
+		m_lastOptimisation->tagsReferencedFromOutside == _tagsReferencedFromOutside
+	)
+		return m_lastOptimisation->tagReplacements;
+	set<size_t> const tagsReferencedFromOutside = _tagsReferencedFromOutside;
+
 	// Run optimisation for sub-assemblies.
 	for (size_t subId = 0; subId < m_subs.size(); ++subId)
 	{
@@ -514,6 +575,8 @@ map<u256, u256> Assembly::optimiseInternal(
 			*this
 		);
 
+	++m_modificationCount;
+	m_lastOptimisation = Optimisation{_settings, tagsReferencedFromOutside, tagReplacements, totalModificationCount()};
 	return tagReplacements;
 }
 
@@ -31,6 +31,8 @@
 
 #include <json/json.h>
 
+#include <boost/optional.hpp>
+
 #include <iostream>
 #include <sstream>
 #include <memory>
@@ -49,9 +51,11 @@ public:
 	AssemblyItem newPushTag() { assertThrow(m_usedTags < 0xffffffff, AssemblyException, ""); return AssemblyItem(PushTag, m_usedTags++); }
 	/// Returns a tag identified by the given name. Creates it if it does not yet exist.
 	AssemblyItem namedTag(std::string const& _name);
-	AssemblyItem newData(bytes const& _data) { h256 h(dev::keccak256(asString(_data))); m_data[h] = _data; return AssemblyItem(PushData, h); }
+	AssemblyItem newData(bytes const& _data) { h256 h(dev::keccak256(asString(_data))); m_data[h] = _data; ++m_modificationCount; return AssemblyItem(PushData, h); }
 	bytes const& data(h256 const& _i) const { return m_data.at(_i); }
-	AssemblyItem newSub(AssemblyPointer const& _sub) { m_subs.push_back(_sub); return AssemblyItem(PushSub, m_subs.size() - 1); }
+	/// Adds @a _sub as sub-assembly. If the same or an identical non-empty sub-assembly
+	/// already exists, it is re-used, so that it is only optimised, assembled and included once.
+	AssemblyItem newSub(AssemblyPointer const& _sub);
 	Assembly const& sub(size_t _sub) const { return *m_subs.at(_sub); }
 	Assembly& sub(size_t _sub) { return *m_subs.at(_sub); }
 	AssemblyItem newPushSubSize(u256 const& _subId) { return AssemblyItem(PushSubSize, _subId); }
@@ -81,13 +85,13 @@ public:
 	void pushSubroutineOffset(size_t _subRoutine) { append(AssemblyItem(PushSub, _subRoutine)); }
 
 	/// Appends @a _data literally to the very end of the bytecode.
-	void appendAuxiliaryDataToEnd(bytes const& _data) { m_auxiliaryData += _data; }
+	void appendAuxiliaryDataToEnd(bytes const& _data) { m_auxiliaryData += _data; ++m_modificationCount; }
 
 	/// Returns the assembly items.
 	AssemblyItems const& items() const { return m_items; }
 
 	/// Returns the mutable assembly items. Use with care!
-	AssemblyItems& items() { return m_items; }
+	AssemblyItems& items() { ++m_modificationCount; return m_items; }
 
 	int deposit() const { return m_deposit; }
 	void adjustDeposit(int _adjustment) { m_deposit += _adjustment; assertThrow(m_deposit >= 0, InvalidDeposit, ""); }
@@ -111,6 +115,19 @@ public:
 		/// This specifies an estimate on how often each opcode in this assembly will be executed,
 		/// i.e. use a small value to optimise for size and a large value to optimise for runtime gas usage.
 		size_t expectedExecutionsPerDeployment = 200;
+
+		bool operator==(OptimiserSettings const& _other) const
+		{
+			return
+				isCreation == _other.isCreation &&
+				runJumpdestRemover == _other.runJumpdestRemover &&
+				runPeephole == _other.runPeephole &&
+				runDeduplicate == _other.runDeduplicate &&
+				runCSE == _other.runCSE &&
+				runConstantOptimiser == _other.runConstantOptimiser &&
+				evmVersion == _other.evmVersion &&
+				expectedExecutionsPerDeployment == _other.expectedExecutionsPerDeployment;
+		}
 	};
 
 	/// Modify and return the current assembly such that creation and execution gas usage
@@ -141,7 +158,7 @@ public:
 
 public:
 	// These features are only used by LLL
-	AssemblyItem newPushString(std::string const& _data) { h256 h(dev::keccak256(_data)); m_strings[h] = _data; return AssemblyItem(PushString, h); }
+	AssemblyItem newPushString(std::string const& _data) { h256 h(dev::keccak256(_data)); m_strings[h] = _data; ++m_modificationCount; return AssemblyItem(PushString, h); }
 
 	void append(Assembly const& _a);
 	void append(Assembly const& _a, int _deposit);
@@ -160,6 +177,13 @@ protected:
 	unsigned bytesRequired(unsigned subTagSize) const;
 
 private:
+	/// @returns true if this assembly and @a _other result in the same bytecode
+	/// and have the same source mappings.
+	bool hasSameContent(Assembly const& _other) const;
+	/// @returns the number of modifications of this assembly and all its sub-assemblies.
+	/// Since the counters only grow, the sum changes whenever any of them is modified.
+	size_t totalModificationCount() const;
+
 	static Json::Value createJsonValue(std::string _name, int _begin, int _end, std::string _value = std::string(), std::string _jumpType = std::string());
 	static std::string toStringInHex(u256 _value);
 
@@ -175,6 +199,20 @@ protected:
 	std::map<h256, std::string> m_strings;
 	std::map<h256, std::string> m_libraries; ///< Identifiers of libraries to be linked.
 
+	/// The last optimisation of this assembly. If the assembly is shared between several
+	/// super-assemblies and was not modified since, it is not optimised again.
+	struct Optimisation
+	{
+		OptimiserSettings settings;
+		std::set<size_t> tagsReferencedFromOutside;
+		std::map<u256, u256> tagReplacements;
+		/// Total modification count of the assembly and its sub-assemblies.
+		size_t modificationCount;
+	};
+	boost::optional<Optimisation> m_lastOptimisation;
+	/// Incremented whenever the items, subs, data, strings or libraries of this assembly are changed.
+	size_t m_modificationCount = 0;
+
 	mutable LinkerObject m_assembledObject;
 	mutable std::vector<size_t> m_tagPositionsInBytecode;
 
@@ -26,6 +26,7 @@
 #include <libevmasm/SimplificationRule.h>
 
 #include <libdevcore/CommonData.h>
+#include <libdevcore/FixedU256.h>
 
 #include <boost/multiprecision/detail/min_max.hpp>
 
@@ -37,21 +38,11 @@ namespace dev
 namespace eth
 {
 
-template <class S> S divWorkaround(S const& _a, S const& _b)
-{
-	return (S)(bigint(_a) / bigint(_b));
-}
-
-template <class S> S modWorkaround(S const& _a, S const& _b)
-{
-	return (S)(bigint(_a) % bigint(_b));
-}
-
 // This works around a bug fixed with Boost 1.64.
 // https://www.boost.org/doc/libs/1_68_0/libs/multiprecision/doc/html/boost_multiprecision/map/hist.html#boost_multiprecision.map.hist.multiprecision_2_3_1_boost_1_64
 inline u256 shlWorkaround(u256 const& _x, unsigned _amount)
 {
-	return u256((bigint(_x) << _amount) & u256(-1));
+	return u256(FixedU256(_x) << _amount);
 }
 
 // simplificationRuleList below was split up into parts to prevent
@@ -71,24 +62,24 @@ std::vector<SimplificationRule<Pattern>> simplificationRuleListPart1(
 		{{Instruction::ADD, {A, B}}, [=]{ return A.d() + B.d(); }, false},
 		{{Instruction::MUL, {A, B}}, [=]{ return A.d() * B.d(); }, false},
 		{{Instruction::SUB, {A, B}}, [=]{ return A.d() - B.d(); }, false},
-		{{Instruction::DIV, {A, B}}, [=]{ return B.d() == 0 ? 0 : divWorkaround(A.d(), B.d()); }, false},
-		{{Instruction::SDIV, {A, B}}, [=]{ return B.d() == 0 ? 0 : s2u(divWorkaround(u2s(A.d()), u2s(B.d()))); }, false},
-		{{Instruction::MOD, {A, B}}, [=]{ return B.d() == 0 ? 0 : modWorkaround(A.d(), B.d()); }, false},
-		{{Instruction::SMOD, {A, B}}, [=]{ return B.d() == 0 ? 0 : s2u(modWorkaround(u2s(A.d()), u2s(B.d()))); }, false},
-		{{Instruction::EXP, {A, B}}, [=]{ return u256(boost::multiprecision::powm(bigint(A.d()), bigint(B.d()), bigint(1) << 256)); }, false},
+		{{Instruction::DIV, {A, B}}, [=]{ return u256(FixedU256(A.d()) / FixedU256(B.d())); }, false},
+		{{Instruction::SDIV, {A, B}}, [=]{ return u256(FixedU256::signedDiv(FixedU256(A.d()), FixedU256(B.d()))); }, false},
+		{{Instruction::MOD, {A, B}}, [=]{ return u256(FixedU256(A.d()) % FixedU256(B.d())); }, false},
+		{{Instruction::SMOD, {A, B}}, [=]{ return u256(FixedU256::signedMod(FixedU256(A.d()), FixedU256(B.d()))); }, false},
+		{{Instruction::EXP, {A, B}}, [=]{ return u256(FixedU256::exp(FixedU256(A.d()), FixedU256(B.d()))); }, false},
 		{{Instruction::NOT, {A}}, [=]{ return ~A.d(); }, false},
 		{{Instruction::LT, {A, B}}, [=]() -> u256 { return A.d() < B.d() ? 1 : 0; }, false},
 		{{Instruction::GT, {A, B}}, [=]() -> u256 { return A.d() > B.d() ? 1 : 0; }, false},
-		{{Instruction::SLT, {A, B}}, [=]() -> u256 { return u2s(A.d()) < u2s(B.d()) ? 1 : 0; }, false},
-		{{Instruction::SGT, {A, B}}, [=]() -> u256 { return u2s(A.d()) > u2s(B.d()) ? 1 : 0; }, false},
+		{{Instruction::SLT, {A, B}}, [=]() -> u256 { return FixedU256::signedLessThan(FixedU256(A.d()), FixedU256(B.d())) ? 1 : 0; }, false},
+		{{Instruction::SGT, {A, B}}, [=]() -> u256 { return FixedU256::signedLessThan(FixedU256(B.d()), FixedU256(A.d())) ? 1 : 0; }, false},
 		{{Instruction::EQ, {A, B}}, [=]() -> u256 { return A.d() == B.d() ? 1 : 0; }, false},
 		{{Instruction::ISZERO, {A}}, [=]() -> u256 { return A.d() == 0 ? 1 : 0; }, false},
 		{{Instruction::AND, {A, B}}, [=]{ return A.d() & B.d(); }, false},
 		{{Instruction::OR, {A, B}}, [=]{ return A.d() | B.d(); }, false},
 		{{Instruction::XOR, {A, B}}, [=]{ return A.d() ^ B.d(); }, false},
 		{{Instruction::BYTE, {A, B}}, [=]{ return A.d() >= 32 ? 0 : (B.d() >> unsigned(8 * (31 - A.d()))) & 0xff; }, false},
-		{{Instruction::ADDMOD, {A, B, C}}, [=]{ return C.d() == 0 ? 0 : u256((bigint(A.d()) + bigint(B.d())) % C.d()); }, false},
-		{{Instruction::MULMOD, {A, B, C}}, [=]{ return C.d() == 0 ? 0 : u256((bigint(A.d()) * bigint(B.d())) % C.d()); }, false},
+		{{Instruction::ADDMOD, {A, B, C}}, [=]{ return u256(FixedU256::addMod(FixedU256(A.d()), FixedU256(B.d()), FixedU256(C.d()))); }, false},
+		{{Instruction::MULMOD, {A, B, C}}, [=]{ return u256(FixedU256::mulMod(FixedU256(A.d()), FixedU256(B.d()), FixedU256(C.d()))); }, false},
 		{{Instruction::SIGNEXTEND, {A, B}}, [=]() -> u256 {
 			if (A.d() >= 31)
 				return B.d();
@@ -105,6 +96,9 @@ std::vector<SimplificationRule<Pattern>> simplificationRuleListPart1(
 			if (A.d() > 255)
 				return u256(0);
 			return B.d() >> unsigned(A.d());
+		}, false},
+		{{Instruction::SAR, {A, B}}, [=]{
+			return u256(FixedU256::arithmeticShiftRight(FixedU256(B.d()), A.d() > 255 ? 256 : unsigned(A.d())));
 		}, false}
 	};
 }
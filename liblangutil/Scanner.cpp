@@ -55,9 +55,14 @@
 #include <liblangutil/Scanner.h>
 #include <boost/optional.hpp>
 #include <algorithm>
+#include <array>
 #include <ostream>
 #include <tuple>
 
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
 using namespace std;
 using namespace langutil;
 
@@ -88,6 +93,125 @@ ostream& langutil::operator<<(ostream& os, ScannerError _errorCode)
 	return os << to_string(_errorCode);
 }
 
+namespace
+{
+
+/// Character classes used by the fast paths of the scanner, which skip
+/// over whole runs of characters instead of advancing one by one.
+enum CharClass: uint8_t
+{
+	WhiteSpaceClass = 1,
+	IdentifierPartClass = 2,
+	PeriodClass = 4,
+	/// Characters that can start a line break, including the lead bytes of
+	/// the multi-byte unicode line breaks (see Scanner::isUnicodeLinebreak).
+	LineBreakCandidateClass = 8,
+	/// Characters that need special treatment inside a string literal.
+	StringSpecialClass = 16
+};
+
+array<uint8_t, 256> makeCharClasses()
+{
+	array<uint8_t, 256> classes{};
+	for (unsigned i = 0; i < classes.size(); ++i)
+	{
+		char c = char(i);
+		if (isWhiteSpace(c))
+			classes[i] |= WhiteSpaceClass;
+		if (isIdentifierPart(c))
+			classes[i] |= IdentifierPartClass;
+		if (c == '.')
+			classes[i] |= PeriodClass;
+		if ((0x0a <= i && i <= 0x0d) || i == 0xc2 || i == 0xe2)
+			classes[i] |= LineBreakCandidateClass | StringSpecialClass;
+		if (c == '"' || c == '\'' || c == '\\')
+			classes[i] |= StringSpecialClass;
+	}
+	return classes;
+}
+
+array<uint8_t, 256> const c_charClasses = makeCharClasses();
+
+#if defined(__SSE2__)
+inline __m128i equalTo(__m128i _chars, char _c)
+{
+	return _mm_cmpeq_epi8(_chars, _mm_set1_epi8(_c));
+}
+
+/// Only valid for ASCII ranges, since characters are compared as signed values.
+inline __m128i inRange(__m128i _chars, char _first, char _last)
+{
+	return _mm_and_si128(
+		_mm_cmpgt_epi8(_chars, _mm_set1_epi8(_first - 1)),
+		_mm_cmplt_epi8(_chars, _mm_set1_epi8(_last + 1))
+	);
+}
+
+/// Classifies 16 characters at once.
+/// @returns a bit mask that has the i-th bit set iff the i-th character
+/// has one of the classes in @a _classes.
+inline unsigned classMask(__m128i _chars, uint8_t _classes)
+{
+	__m128i matches = _mm_setzero_si128();
+	if (_classes & WhiteSpaceClass)
+		matches = _mm_or_si128(matches, _mm_or_si128(
+			_mm_or_si128(equalTo(_chars, ' '), equalTo(_chars, '\n')),
+			_mm_or_si128(equalTo(_chars, '\t'), equalTo(_chars, '\r'))
+		));
+	if (_classes & IdentifierPartClass)
+		matches = _mm_or_si128(matches, _mm_or_si128(
+			_mm_or_si128(inRange(_chars, 'a', 'z'), inRange(_chars, 'A', 'Z')),
+			_mm_or_si128(
+				inRange(_chars, '0', '9'),
+				_mm_or_si128(equalTo(_chars, '_'), equalTo(_chars, '$'))
+			)
+		));
+	if (_classes & PeriodClass)
+		matches = _mm_or_si128(matches, equalTo(_chars, '.'));
+	if (_classes & (LineBreakCandidateClass | StringSpecialClass))
+		matches = _mm_or_si128(matches, _mm_or_si128(
+			inRange(_chars, 0x0a, 0x0d),
+			_mm_or_si128(equalTo(_chars, char(0xc2)), equalTo(_chars, char(0xe2)))
+		));
+	if (_classes & StringSpecialClass)
+		matches = _mm_or_si128(matches, _mm_or_si128(
+			_mm_or_si128(equalTo(_chars, '"'), equalTo(_chars, '\'')),
+			equalTo(_chars, '\\')
+		));
+	return unsigned(_mm_movemask_epi8(matches));
+}
+#endif
+
+/// @returns the first position at or after @a _position whose character has
+/// (if @a _inClass is true) or does not have (otherwise) one of the classes in @a _classes,
+/// or the size of @a _source if there is no such position.
+inline size_t findClassBoundary(
+	string const& _source,
+	size_t _position,
+	uint8_t _classes,
+	bool _inClass
+)
+{
+	char const* data = _source.data();
+	size_t const end = _source.size();
+#if defined(__SSE2__)
+	for (; _position + 16 <= end; _position += 16)
+	{
+		__m128i chars = _mm_loadu_si128(reinterpret_cast<__m128i const*>(data + _position));
+		unsigned mask = classMask(chars, _classes);
+		if (!_inClass)
+			mask = ~mask & 0xffff;
+		if (mask)
+			return _position + unsigned(__builtin_ctz(mask));
+	}
+#endif
+	while (_position < end && bool(c_charClasses[uint8_t(data[_position])] & _classes) != _inClass)
+		++_position;
+	return _position;
+}
+
+}
+
 namespace langutil
 {
 
@@ -257,11 +381,13 @@ Token Scanner::selectToken(char _next, Token _then, Token _else)
 
 bool Scanner::skipWhitespace()
 {
-	int const startPosition = sourcePos();
-	while (isWhiteSpace(m_char))
-		advance();
-	// Return whether or not we skipped any characters.
-	return sourcePos() != startPosition;
+	// m_char can differ from the character at the current position
+	// (see skipMultiLineComment), so it has to be consumed separately.
+	if (!isWhiteSpace(m_char))
+		return false;
+	advance();
+	m_char = m_source->setPosition(findClassBoundary(source(), sourcePos(), WhiteSpaceClass, false));
+	return true;
 }
 
 void Scanner::skipWhitespaceExceptUnicodeLinebreak()
@@ -274,8 +400,10 @@ Token Scanner::skipSingleLineComment()
 {
 	// Line terminator is not part of the comment. If it is a
 	// non-ascii line terminator, it will result in a parser error.
-	while (!isUnicodeLinebreak())
-		if (!advance()) break;
+	while (!isSourcePastEndOfInput() && !isUnicodeLinebreak())
+		m_char = m_source->setPosition(
+			findClassBoundary(source(), sourcePos() + 1, LineBreakCandidateClass, true)
+		);
 
 	return Token::Whitespace;
 }
@@ -309,8 +437,12 @@ Token Scanner::scanSingleLineDocComment()
 			// Any line terminator that is not '\n' is considered to end the
 			// comment.
 			break;
-		addCommentLiteralChar(m_char);
-		advance();
+		// The current character is part of the comment, and so is everything
+		// up to the next character that could start a line break.
+		size_t runStart = sourcePos();
+		size_t runEnd = findClassBoundary(source(), runStart + 1, LineBreakCandidateClass, true);
+		m_nextSkippedComment.literal.append(source(), runStart, runEnd - runStart);
+		m_char = m_source->setPosition(runEnd);
 	}
 	literal.complete();
 	return Token::CommentLiteral;
@@ -319,21 +451,26 @@ Token Scanner::scanSingleLineDocComment()
 Token Scanner::skipMultiLineComment()
 {
 	advance();
-	while (!isSourcePastEndOfInput())
+	string const& text = source();
+	for (size_t position = sourcePos(); position < text.size();)
 	{
-		char ch = m_char;
-		advance();
+		size_t star = text.find('*', position);
+		if (star == string::npos || star + 1 >= text.size())
+			break;
 
 		// If we have reached the end of the multi-line comment, we
 		// consume the '/' and insert a whitespace. This way all
 		// multi-line comments are treated as whitespace.
-		if (ch == '*' && m_char == '/')
+		if (text[star + 1] == '/')
 		{
+			m_source->setPosition(star + 1);
 			m_char = ' ';
 			return Token::Whitespace;
 		}
+		position = star + 1;
 	}
 	// Unterminated multi-line comment.
+	m_char = m_source->setPosition(text.size());
 	return setError(ScannerError::IllegalCommentTerminator);
 }
 
@@ -737,6 +874,16 @@ Token Scanner::scanString()
 	LiteralScope literal(this, LITERAL_TYPE_STRING);
 	while (m_char != quote && !isSourcePastEndOfInput() && !isUnicodeLinebreak())
 	{
+		// Copy characters that do not need special treatment in one go.
+		size_t runStart = sourcePos();
+		size_t runEnd = findClassBoundary(source(), runStart, StringSpecialClass, true);
+		if (runEnd != runStart)
+		{
+			m_nextToken.literal.append(source(), runStart, runEnd - runStart);
+			m_char = m_source->setPosition(runEnd);
+			continue;
+		}
+
 		char c = m_char;
 		advance();
 		if (c == '\\')
@@ -889,10 +1036,12 @@ tuple<Token, unsigned, unsigned> Scanner::scanIdentifierOrKeyword()
 {
 	solAssert(isIdentifierStart(m_char), "");
 	LiteralScope literal(this, LITERAL_TYPE_STRING);
-	addLiteralCharAndAdvance();
 	// Scan the rest of the identifier characters.
-	while (isIdentifierPart(m_char) || (m_char == '.' && m_supportPeriodInIdentifier))
-		addLiteralCharAndAdvance();
+	size_t start = sourcePos();
+	uint8_t classes = IdentifierPartClass | (m_supportPeriodInIdentifier ? PeriodClass : 0);
+	size_t end = findClassBoundary(source(), start + 1, classes, false);
+	m_nextToken.literal.assign(source(), start, end - start);
+	m_char = m_source->setPosition(end);
 	literal.complete();
 	return TokenTraits::fromIdentifierOrKeyword(m_nextToken.literal);
 }
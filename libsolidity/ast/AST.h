@@ -30,6 +30,7 @@
 
 #include <liblangutil/SourceLocation.h>
 #include <libevmasm/Instruction.h>
+#include <libdevcore/Arena.h>
 #include <libdevcore/FixedHash.h>
 
 #include <boost/noncopyable.hpp>
@@ -106,12 +107,28 @@ public:
 	///@}
 
 protected:
+	/// Creates the annotation of type T if it does not exist yet and returns it.
+	/// The annotation is placed into the arena of the node, if it has one.
+	template <class T>
+	T& initAnnotation() const
+	{
+		if (!m_annotation)
+			m_annotation = m_arena ? m_arena->create<T>() : new T();
+		return dynamic_cast<T&>(*m_annotation);
+	}
+
 	size_t const m_id = 0;
 	/// Annotation - is specialised in derived classes, is created upon request (because of polymorphism).
 	mutable ASTAnnotation* m_annotation = nullptr;
 
 private:
+	/// The parser allocates nodes from an arena and registers it here.
+	friend class Parser;
+
 	SourceLocation m_location;
+	/// Arena the node and its annotation are allocated from, if any.
+	/// It is kept alive by the allocator of the shared pointer owning the node.
+	Arena* m_arena = nullptr;
 };
 
 template <class _T>
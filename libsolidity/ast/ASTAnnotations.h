@@ -47,6 +47,7 @@ namespace solidity
 
 class Type;
 using TypePointer = Type const*;
+class BoundFunctionIndex;
 
 struct ASTAnnotation
 {
@@ -103,6 +104,9 @@ struct ContractDefinitionAnnotation: TypeDeclarationAnnotation, DocumentedAnnota
 	/// Mapping containing the nodes that define the arguments for base constructors.
 	/// These can either be inheritance specifiers or modifier invocations.
 	std::map<FunctionDefinition const*, ASTNode const*> baseConstructorArguments;
+	/// Functions attached to types by `using for` directives visible in this contract.
+	/// Created on the first member lookup in the scope of this contract.
+	std::shared_ptr<BoundFunctionIndex const> boundFunctions;
 };
 
 struct FunctionDefinitionAnnotation: ASTAnnotation, DocumentedAnnotation
@@ -243,6 +243,79 @@ u256 const& MemberList::storageSize() const
 	return m_storageOffsets->storageSize();
 }
 
+BoundFunctionIndex::BoundFunctionIndex(ContractDefinition const& _scope)
+{
+	map<FunctionDefinition const*, FunctionTypePointer> callableTypes;
+	for (ContractDefinition const* contract: _scope.annotation().linearizedBaseContracts)
+		for (UsingForDirective const* ufd: contract->usingForDirectives())
+		{
+			// Normalise data location of type.
+			string typeIdentifier;
+			if (ufd->typeName())
+				typeIdentifier = TypeProvider::withLocationIfReference(
+					DataLocation::Storage,
+					ufd->typeName()->annotation().type
+				)->richIdentifier();
+			auto const& library = dynamic_cast<ContractDefinition const&>(
+				*ufd->libraryName().annotation().referencedDeclaration
+			);
+			for (FunctionDefinition const* function: library.definedFunctions())
+			{
+				if (!function->isVisibleAsLibraryMember() || function->parameters().empty())
+					continue;
+				FunctionTypePointer& callableType = callableTypes[function];
+				if (!callableType)
+					callableType = FunctionType(*function, false).asCallableFunction(true, true);
+				m_entriesByType[typeIdentifier].push_back(m_entries.size());
+				m_entriesByTypeAndName[make_pair(typeIdentifier, function->name())].push_back(m_entries.size());
+				m_entries.push_back(Entry{function, callableType});
+			}
+		}
+}
+
+MemberList::MemberMap BoundFunctionIndex::boundFunctions(Type const& _type, string const* _name) const
+{
+	if (m_entries.empty())
+		return {};
+
+	static vector<size_t> const noEntries;
+	auto entriesFor = [&](string const& _typeIdentifier) -> vector<size_t> const& {
+		if (_name)
+		{
+			auto it = m_entriesByTypeAndName.find(make_pair(_typeIdentifier, *_name));
+			return it == m_entriesByTypeAndName.end() ? noEntries : it->second;
+		}
+		auto it = m_entriesByType.find(_typeIdentifier);
+		return it == m_entriesByType.end() ? noEntries : it->second;
+	};
+	// Normalise data location of type.
+	vector<size_t> const& typeEntries = entriesFor(
+		TypeProvider::withLocationIfReference(DataLocation::Storage, &_type)->richIdentifier()
+	);
+	vector<size_t> const& wildcardEntries = entriesFor(string());
+	vector<size_t> entries;
+	entries.reserve(typeEntries.size() + wildcardEntries.size());
+	merge(
+		typeEntries.begin(),
+		typeEntries.end(),
+		wildcardEntries.begin(),
+		wildcardEntries.end(),
+		back_inserter(entries)
+	);
+
+	set<FunctionDefinition const*> seenFunctions;
+	MemberList::MemberMap members;
+	for (size_t index: entries)
+	{
+		Entry const& entry = m_entries[index];
+		if (!seenFunctions.insert(entry.function).second)
+			continue;
+		if (_type.isImplicitlyConvertibleTo(*entry.type->selfType()))
+			members.emplace_back(entry.function->name(), entry.type, entry.function);
+	}
+	return members;
+}
+
 /// Helper functions for type identifier
 namespace
 {
@@ -324,14 +397,41 @@ TypePointer Type::commonType(Type const* _a, Type const* _b)
 
 MemberList const& Type::members(ContractDefinition const* _currentScope) const
 {
-	if (!m_members[_currentScope])
+	shared_ptr<MemberList const>& memberList = m_members[_currentScope];
+	if (!memberList)
 	{
-		MemberList::MemberMap members = nativeMembers(_currentScope);
-		if (_currentScope)
-			members += boundFunctions(*this, *_currentScope);
-		m_members[_currentScope] = unique_ptr<MemberList>(new MemberList(move(members)));
+		if (!_currentScope || nativeMembersDependOnScope())
+		{
+			MemberList::MemberMap members = nativeMembers(_currentScope);
+			if (_currentScope)
+				members += boundFunctions(*this, *_currentScope);
+			memberList = make_shared<MemberList>(move(members));
+		}
+		else
+		{
+			// Re-use the native members computed for the empty scope.
+			MemberList const& nativeMemberList = members(nullptr);
+			MemberList::MemberMap bound = boundFunctions(*this, *_currentScope);
+			if (bound.empty())
+				memberList = m_members.at(nullptr);
+			else
+			{
+				MemberList::MemberMap members(nativeMemberList.begin(), nativeMemberList.end());
+				members += move(bound);
+				memberList = make_shared<MemberList>(move(members));
+			}
+		}
 	}
-	return *m_members[_currentScope];
+	return *memberList;
+}
+
+MemberList::MemberMap Type::membersByName(string const& _name, ContractDefinition const* _currentScope) const
+{
+	if (!_currentScope || nativeMembersDependOnScope() || m_members.count(_currentScope))
+		return members(_currentScope).membersByName(_name);
+	MemberList::MemberMap members = this->members(nullptr).membersByName(_name);
+	members += boundFunctions(*this, *_currentScope, &_name);
+	return members;
 }
 
 TypePointer Type::fullEncodingType(bool _inLibraryCall, bool _encoderV2, bool) const
@@ -355,36 +455,16 @@ TypePointer Type::fullEncodingType(bool _inLibraryCall, bool _encoderV2, bool) c
 	return encodingType;
 }
 
-MemberList::MemberMap Type::boundFunctions(Type const& _type, ContractDefinition const& _scope)
+MemberList::MemberMap Type::boundFunctions(
+	Type const& _type,
+	ContractDefinition const& _scope,
+	string const* _name
+)
 {
-	// Normalise data location of type.
-	TypePointer type = TypeProvider::withLocationIfReference(DataLocation::Storage, &_type);
-	set<Declaration const*> seenFunctions;
-	MemberList::MemberMap members;
-	for (ContractDefinition const* contract: _scope.annotation().linearizedBaseContracts)
-		for (UsingForDirective const* ufd: contract->usingForDirectives())
-		{
-			if (ufd->typeName() && *type != *TypeProvider::withLocationIfReference(
-				DataLocation::Storage,
-				ufd->typeName()->annotation().type
-			))
-				continue;
-			auto const& library = dynamic_cast<ContractDefinition const&>(
-				*ufd->libraryName().annotation().referencedDeclaration
-			);
-			for (FunctionDefinition const* function: library.definedFunctions())
-			{
-				if (!function->isVisibleAsLibraryMember() || seenFunctions.count(function))
-					continue;
-				seenFunctions.insert(function);
-				if (function->parameters().empty())
-					continue;
-				FunctionTypePointer fun = FunctionType(*function, false).asCallableFunction(true, true);
-				if (_type.isImplicitlyConvertibleTo(*fun->selfType()))
-					members.emplace_back(function->name(), fun, function);
-			}
-		}
-	return members;
+	shared_ptr<BoundFunctionIndex const>& index = _scope.annotation().boundFunctions;
+	if (!index)
+		index = make_shared<BoundFunctionIndex>(_scope);
+	return index->boundFunctions(_type, _name);
 }
 
 AddressType::AddressType(StateMutability _stateMutability):
@@ -108,7 +108,7 @@ public:
 
 	using MemberMap = std::vector<Member>;
 
-	explicit MemberList(MemberMap const& _members): m_memberTypes(_members) {}
+	explicit MemberList(MemberMap _members): m_memberTypes(std::move(_members)) {}
 
 	void combine(MemberList const& _other);
 	TypePointer memberType(std::string const& _name) const
@@ -146,6 +146,38 @@ private:
 
 static_assert(std::is_nothrow_move_constructible<MemberList>::value, "MemberList should be noexcept move constructible");
 
+/**
+ * Index of the library functions attached to types via `using for` directives
+ * that are visible inside a contract (including those of its bases).
+ * Built once per contract, so that member lookups do not have to scan
+ * all `using for` directives and library functions again.
+ */
+class BoundFunctionIndex
+{
+public:
+	explicit BoundFunctionIndex(ContractDefinition const& _scope);
+
+	/// @returns the functions bound to @a _type in the order of their declaration,
+	/// restricted to functions with the name @a _name if it is given.
+	MemberList::MemberMap boundFunctions(Type const& _type, std::string const* _name = nullptr) const;
+
+private:
+	struct Entry
+	{
+		FunctionDefinition const* function;
+		FunctionTypePointer type;
+	};
+
+	/// All functions of all libraries attached to some type, in the order of the directives.
+	/// A function can be contained multiple times.
+	std::vector<Entry> m_entries;
+	/// Indices into m_entries by the identifier of the type they are attached to.
+	/// The empty identifier is used for `using for *`.
+	std::map<std::string, std::vector<size_t>> m_entriesByType;
+	/// Indices into m_entries by type identifier (as above) and function name.
+	std::map<std::pair<std::string, std::string>, std::vector<size_t>> m_entriesByTypeAndName;
+};
+
 /**
  * Abstract base class that forms the root of the type hierarchy.
  */
@@ -268,6 +300,9 @@ public:
 	/// Returns the list of all members of this type. Default implementation: no members apart from bound.
 	/// @param _currentScope scope in which the members are accessed.
 	MemberList const& members(ContractDefinition const* _currentScope) const;
+	/// @returns the members of this type with the given name, in the same order as in members().
+	/// Does not construct the full member list for @a _currentScope if it is not needed.
+	MemberList::MemberMap membersByName(std::string const& _name, ContractDefinition const* _currentScope) const;
 	/// Convenience method, returns the type of the given named member or an empty pointer if no such member exists.
 	TypePointer memberType(std::string const& _name, ContractDefinition const* _currentScope = nullptr) const
 	{
@@ -312,8 +347,13 @@ public:
 	virtual void clearCache() const;
 
 private:
-	/// @returns a member list containing all members added to this type by `using for` directives.
-	static MemberList::MemberMap boundFunctions(Type const& _type, ContractDefinition const& _scope);
+	/// @returns a member list containing all members added to this type by `using for` directives,
+	/// restricted to those with the name @a _name if it is given.
+	static MemberList::MemberMap boundFunctions(
+		Type const& _type,
+		ContractDefinition const& _scope,
+		std::string const* _name = nullptr
+	);
 
 protected:
 	/// @returns the members native to this type depending on the given context. This function
@@ -322,9 +362,13 @@ protected:
 	{
 		return MemberList::MemberMap();
 	}
+	/// @returns false if nativeMembers returns the same members for every scope,
+	/// which allows all scopes to share the native members computed for the empty scope.
+	virtual bool nativeMembersDependOnScope() const { return false; }
 
 	/// List of member types (parameterised by scape), will be lazy-initialized.
-	mutable std::map<ContractDefinition const*, std::unique_ptr<MemberList>> m_members;
+	/// Scopes without bound functions share the list of the empty scope.
+	mutable std::map<ContractDefinition const*, std::shared_ptr<MemberList const>> m_members;
 };
 
 /**
@@ -783,6 +827,7 @@ public:
 	std::string canonicalName() const override;
 
 	MemberList::MemberMap nativeMembers(ContractDefinition const* _currentScope) const override;
+	bool nativeMembersDependOnScope() const override { return true; }
 
 	Type const* encodingType() const override;
 
@@ -1264,6 +1309,7 @@ public:
 	bool hasSimpleZeroValueInMemory() const override { solAssert(false, ""); }
 	std::string toString(bool _short) const override { return "type(" + m_actualType->toString(_short) + ")"; }
 	MemberList::MemberMap nativeMembers(ContractDefinition const* _currentScope) const override;
+	bool nativeMembersDependOnScope() const override { return m_actualType->category() == Category::Contract; }
 
 private:
 	TypePointer m_actualType;
@@ -35,10 +35,16 @@ namespace solidity {
 class Compiler
 {
 public:
-	explicit Compiler(langutil::EVMVersion _evmVersion, OptimiserSettings _optimiserSettings):
+	/// @param _yulFunctionCache if not null, generated ABI functions are shared through
+	/// this cache with the compilers of other contracts.
+	explicit Compiler(
+		langutil::EVMVersion _evmVersion,
+		OptimiserSettings _optimiserSettings,
+		std::shared_ptr<YulFunctionCache> _yulFunctionCache = nullptr
+	):
 		m_optimiserSettings(std::move(_optimiserSettings)),
-		m_runtimeContext(_evmVersion),
-		m_context(_evmVersion, &m_runtimeContext)
+		m_runtimeContext(_evmVersion, nullptr, _yulFunctionCache),
+		m_context(_evmVersion, &m_runtimeContext, _yulFunctionCache)
 	{ }
 
 	/// Compiles a contract.
@@ -42,8 +42,10 @@
 
 #include <boost/algorithm/string/replace.hpp>
 
-#include <utility>
+#include <mutex>
 #include <numeric>
+#include <tuple>
+#include <utility>
 
 // Change to "define" to output all intermediate code
 #undef SOL_OUTPUT_ASM
@@ -325,6 +327,25 @@ void CompilerContext::resetVisitedNodes(ASTNode const* _node)
 	updateSourceLocation();
 }
 
+namespace
+{
+
+/// Inline assembly block generated by the code generator, after parsing, analysis and
+/// optimisation. The code transform does not modify it, so it can be shared.
+/// The source the locations in the block refer to is kept along with it.
+struct AnalysedInlineAssembly
+{
+	shared_ptr<langutil::CharStream> source;
+	shared_ptr<yul::Block> code;
+	shared_ptr<yul::AsmAnalysisInfo> analysisInfo;
+};
+
+/// Source, local variables, EVM version and, if the block is optimised, the externally used
+/// functions, creation flag, expected executions and whether to optimise stack allocation.
+using InlineAssemblyCacheKey = tuple<string, vector<string>, EVMVersion, bool, set<string>, bool, size_t, bool>;
+
+}
+
 void CompilerContext::appendInlineAssembly(
 	string const& _assembly,
 	vector<string> const& _localVariables,
@@ -333,13 +354,33 @@ void CompilerContext::appendInlineAssembly(
 	OptimiserSettings const& _optimiserSettings
 )
 {
+	// The code generator produces the same blocks over and over again, so the result of
+	// parsing and analysing them is cached. The cached ASTs refer to YulStrings, so the
+	// cache has to be cleared together with the YulStringRepository.
+	static size_t const c_maxCachedBlocks = 4096;
+	static mutex cacheMutex;
+	static map<InlineAssemblyCacheKey, AnalysedInlineAssembly> cache;
+	static yul::YulStringRepository::ResetCallback callback{[&] {
+		lock_guard<mutex> lock(cacheMutex);
+		cache.clear();
+	}};
+
 	int startStackHeight = stackHeight();
 
-	set<yul::YulString> externallyUsedIdentifiers;
-	for (auto const& fun: _externallyUsedFunctions)
-		externallyUsedIdentifiers.insert(yul::YulString(fun));
-	for (auto const& var: _localVariables)
-		externallyUsedIdentifiers.insert(yul::YulString(var));
+	// Several optimizer steps cannot handle externally supplied stack variables,
+	// so we essentially only optimize the ABI functions.
+	bool const optimize = _optimiserSettings.runYulOptimiser && _localVariables.empty();
+	bool const isCreation = m_runtimeContext != nullptr;
+	InlineAssemblyCacheKey key{
+		_assembly,
+		_localVariables,
+		m_evmVersion,
+		optimize,
+		optimize ? _externallyUsedFunctions : set<string>{},
+		optimize && isCreation,
+		optimize ? _optimiserSettings.expectedExecutionsPerDeployment : 0,
+		optimize && _optimiserSettings.optimizeStackAllocation
+	};
 
 	yul::ExternalIdentifierAccess identifierAccess;
 	identifierAccess.resolve = [&](
@@ -380,79 +421,100 @@ void CompilerContext::appendInlineAssembly(
 		}
 	};
 
-	ErrorList errors;
-	ErrorReporter errorReporter(errors);
-	auto scanner = make_shared<langutil::Scanner>(langutil::CharStream(_assembly, "--CODEGEN--"));
-	yul::EVMDialect const& dialect = yul::EVMDialect::strictAssemblyForEVM(m_evmVersion);
-	auto parserResult = yul::Parser(errorReporter, dialect).parse(scanner, false);
-#ifdef SOL_OUTPUT_ASM
-	cout << yul::AsmPrinter()(*parserResult) << endl;
-#endif
-
-	auto reportError = [&](string const& _context)
+	AnalysedInlineAssembly analysed;
 	{
-		string message =
-			"Error parsing/analyzing inline assembly block:\n" +
-			_context + "\n"
-			"------------------ Input: -----------------\n" +
-			_assembly + "\n"
-			"------------------ Errors: ----------------\n";
-		for (auto const& error: errorReporter.errors())
-			message += SourceReferenceFormatter::formatErrorInformation(*error);
-		message += "-------------------------------------------\n";
-
-		solAssert(false, message);
-	};
-
-	yul::AsmAnalysisInfo analysisInfo;
-	bool analyzerResult = false;
-	if (parserResult)
-		analyzerResult = yul::AsmAnalyzer(
-			analysisInfo,
-			errorReporter,
-			boost::none,
-			dialect,
-			identifierAccess.resolve
-		).analyze(*parserResult);
-	if (!parserResult || !errorReporter.errors().empty() || !analyzerResult)
-		reportError("Invalid assembly generated by code generator.");
+		lock_guard<mutex> lock(cacheMutex);
+		auto it = cache.find(key);
+		if (it != cache.end())
+			analysed = it->second;
+	}
 
-	// Several optimizer steps cannot handle externally supplied stack variables,
-	// so we essentially only optimize the ABI functions.
-	if (_optimiserSettings.runYulOptimiser && _localVariables.empty())
+	if (!analysed.code)
 	{
-		bool const isCreation = m_runtimeContext != nullptr;
-		yul::GasMeter meter(dialect, isCreation, _optimiserSettings.expectedExecutionsPerDeployment);
-		yul::OptimiserSuite::run(
-			dialect,
-			&meter,
-			*parserResult,
-			analysisInfo,
-			_optimiserSettings.optimizeStackAllocation,
-			externallyUsedIdentifiers
-		);
-		analysisInfo = yul::AsmAnalysisInfo{};
-		if (!yul::AsmAnalyzer(
-			analysisInfo,
-			errorReporter,
-			boost::none,
-			dialect,
-			identifierAccess.resolve
-		).analyze(*parserResult))
-			reportError("Optimizer introduced error into inline assembly.");
+		set<yul::YulString> externallyUsedIdentifiers;
+		for (auto const& fun: _externallyUsedFunctions)
+			externallyUsedIdentifiers.insert(yul::YulString(fun));
+		for (auto const& var: _localVariables)
+			externallyUsedIdentifiers.insert(yul::YulString(var));
+
+		ErrorList errors;
+		ErrorReporter errorReporter(errors);
+		auto scanner = make_shared<langutil::Scanner>(langutil::CharStream(_assembly, "--CODEGEN--"));
+		analysed.source = scanner->charStream();
+		yul::EVMDialect const& dialect = yul::EVMDialect::strictAssemblyForEVM(m_evmVersion);
+		analysed.code = yul::Parser(errorReporter, dialect).parse(scanner, false);
 #ifdef SOL_OUTPUT_ASM
-		cout << "After optimizer: " << endl;
-		cout << yul::AsmPrinter()(*parserResult) << endl;
+		cout << yul::AsmPrinter()(*analysed.code) << endl;
 #endif
-	}
 
-	if (!errorReporter.errors().empty())
-		reportError("Failed to analyze inline assembly block.");
+		auto reportError = [&](string const& _context)
+		{
+			string message =
+				"Error parsing/analyzing inline assembly block:\n" +
+				_context + "\n"
+				"------------------ Input: -----------------\n" +
+				_assembly + "\n"
+				"------------------ Errors: ----------------\n";
+			for (auto const& error: errorReporter.errors())
+				message += SourceReferenceFormatter::formatErrorInformation(*error);
+			message += "-------------------------------------------\n";
+
+			solAssert(false, message);
+		};
+
+		analysed.analysisInfo = make_shared<yul::AsmAnalysisInfo>();
+		bool analyzerResult = false;
+		if (analysed.code)
+			analyzerResult = yul::AsmAnalyzer(
+				*analysed.analysisInfo,
+				errorReporter,
+				boost::none,
+				dialect,
+				identifierAccess.resolve
+			).analyze(*analysed.code);
+		if (!analysed.code || !errorReporter.errors().empty() || !analyzerResult)
+			reportError("Invalid assembly generated by code generator.");
+
+		if (optimize)
+		{
+			yul::GasMeter meter(dialect, isCreation, _optimiserSettings.expectedExecutionsPerDeployment);
+			yul::OptimiserSuite::run(
+				dialect,
+				&meter,
+				*analysed.code,
+				*analysed.analysisInfo,
+				_optimiserSettings.optimizeStackAllocation,
+				externallyUsedIdentifiers
+			);
+			*analysed.analysisInfo = yul::AsmAnalysisInfo{};
+			if (!yul::AsmAnalyzer(
+				*analysed.analysisInfo,
+				errorReporter,
+				boost::none,
+				dialect,
+				identifierAccess.resolve
+			).analyze(*analysed.code))
+				reportError("Optimizer introduced error into inline assembly.");
+#ifdef SOL_OUTPUT_ASM
+			cout << "After optimizer: " << endl;
+			cout << yul::AsmPrinter()(*analysed.code) << endl;
+#endif
+		}
+
+		if (!errorReporter.errors().empty())
+			reportError("Failed to analyze inline assembly block.");
+
+		solAssert(errorReporter.errors().empty(), "Failed to analyze inline assembly block.");
+
+		lock_guard<mutex> lock(cacheMutex);
+		if (cache.size() >= c_maxCachedBlocks)
+			cache.clear();
+		cache.emplace(move(key), analysed);
+	}
 
-	solAssert(errorReporter.errors().empty(), "Failed to analyze inline assembly block.");
 	yul::CodeGenerator::assemble(
-		*parserResult,
-		analysisInfo,
+		*analysed.code,
+		*analysed.analysisInfo,
 		*m_asm,
 		m_evmVersion,
 		identifierAccess,
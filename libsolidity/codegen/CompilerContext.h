@@ -52,11 +52,20 @@ class Compiler;
 class CompilerContext
 {
 public:
-	explicit CompilerContext(langutil::EVMVersion _evmVersion, CompilerContext* _runtimeContext = nullptr):
+	/// @param _yulFunctionCache if not null, ABI functions are taken from and added to this
+	/// cache, which is shared with the contexts of other contracts.
+	explicit CompilerContext(
+		langutil::EVMVersion _evmVersion,
+		CompilerContext* _runtimeContext = nullptr,
+		std::shared_ptr<YulFunctionCache> _yulFunctionCache = nullptr
+	):
 		m_asm(std::make_shared<eth::Assembly>()),
 		m_evmVersion(_evmVersion),
 		m_runtimeContext(_runtimeContext),
-		m_abiFunctions(m_evmVersion)
+		m_abiFunctions(
+			m_evmVersion,
+			std::make_shared<MultiUseYulFunctionCollector>(m_evmVersion, std::move(_yulFunctionCache))
+		)
 	{
 		if (m_runtimeContext)
 			m_runtimeSub = size_t(m_asm->newSub(m_runtimeContext->m_asm).data());
@@ -41,12 +41,41 @@ string MultiUseYulFunctionCollector::requestedFunctions()
 
 string MultiUseYulFunctionCollector::createFunction(string const& _name, function<string ()> const& _creator)
 {
-	if (!m_requestedFunctions.count(_name))
+	if (!m_dependencies.empty())
+		m_dependencies.back().insert(_name);
+	if (m_requestedFunctions.count(_name))
+		return _name;
+
+	if (m_cache)
 	{
-		string fun = _creator();
-		solAssert(!fun.empty(), "");
-		solAssert(fun.find("function " + _name) != string::npos, "Function not properly named.");
-		m_requestedFunctions[_name] = std::move(fun);
+		auto it = m_cache->functions.find(make_pair(m_evmVersion, _name));
+		if (it != m_cache->functions.end())
+		{
+			addCachedFunction(_name, it->second);
+			return _name;
+		}
 	}
+
+	m_dependencies.emplace_back();
+	string fun = _creator();
+	set<string> dependencies = std::move(m_dependencies.back());
+	m_dependencies.pop_back();
+	solAssert(!fun.empty(), "");
+	solAssert(fun.find("function " + _name) != string::npos, "Function not properly named.");
+	if (m_cache)
+		m_cache->functions[make_pair(m_evmVersion, _name)] = YulFunctionCache::Function{fun, std::move(dependencies)};
+	m_requestedFunctions[_name] = std::move(fun);
 	return _name;
 }
+
+void MultiUseYulFunctionCollector::addCachedFunction(string const& _name, YulFunctionCache::Function const& _function)
+{
+	m_requestedFunctions[_name] = _function.code;
+	for (string const& dependency: _function.dependencies)
+		if (!m_requestedFunctions.count(dependency))
+		{
+			auto it = m_cache->functions.find(make_pair(m_evmVersion, dependency));
+			solAssert(it != m_cache->functions.end(), "Dependency of cached function not cached.");
+			addCachedFunction(dependency, it->second);
+		}
+}
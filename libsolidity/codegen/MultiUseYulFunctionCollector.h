@@ -21,15 +21,36 @@
 
 #pragma once
 
+#include <liblangutil/EVMVersion.h>
+
 #include <functional>
 #include <map>
+#include <memory>
+#include <set>
 #include <string>
+#include <vector>
 
 namespace dev
 {
 namespace solidity
 {
 
+/**
+ * Yul functions created by a MultiUseYulFunctionCollector, together with the names of
+ * the functions they use. It is shared by the collectors of all contracts of a
+ * compilation, so that each function is created only once.
+ */
+struct YulFunctionCache
+{
+	struct Function
+	{
+		std::string code;
+		std::set<std::string> dependencies;
+	};
+	/// Functions by EVM version and name.
+	std::map<std::pair<langutil::EVMVersion, std::string>, Function> functions;
+};
+
 /**
  * Container of (unparsed) Yul functions identified by name which are meant to be generated
  * only once.
@@ -37,6 +58,14 @@ namespace solidity
 class MultiUseYulFunctionCollector
 {
 public:
+	MultiUseYulFunctionCollector() = default;
+	/// Creates a collector that takes functions from and adds functions to @a _cache
+	/// if it is not null.
+	MultiUseYulFunctionCollector(langutil::EVMVersion _evmVersion, std::shared_ptr<YulFunctionCache> _cache):
+		m_evmVersion(_evmVersion),
+		m_cache(std::move(_cache))
+	{}
+
 	/// Helper function that uses @a _creator to create a function and add it to
 	/// @a m_requestedFunctions if it has not been created yet and returns @a _name in both
 	/// cases.
@@ -48,8 +77,16 @@ public:
 	std::string requestedFunctions();
 
 private:
+	/// Adds the cached function @a _function and the functions it uses to the
+	/// requested functions.
+	void addCachedFunction(std::string const& _name, YulFunctionCache::Function const& _function);
+
 	/// Map from function name to code for a multi-use function.
 	std::map<std::string, std::string> m_requestedFunctions;
+	langutil::EVMVersion m_evmVersion;
+	std::shared_ptr<YulFunctionCache> m_cache;
+	/// Names of the functions used by each of the functions that are currently being created.
+	std::vector<std::set<std::string>> m_dependencies;
 };
 
 }
@@ -30,6 +30,7 @@
 #include <libsolidity/codegen/CompilerUtils.h>
 
 #include <libyul/AssemblyStack.h>
+#include <libyul/Object.h>
 #include <libyul/Utilities.h>
 
 #include <libdevcore/CommonData.h>
@@ -44,7 +45,20 @@ using namespace std;
 using namespace dev;
 using namespace dev::solidity;
 
-pair<string, string> IRGenerator::run(ContractDefinition const& _contract)
+namespace
+{
+
+string const c_warning =
+	"/*******************************************************\n"
+	" *                       WARNING                       *\n"
+	" *  Solidity to Yul compilation is still EXPERIMENTAL  *\n"
+	" *       It can result in LOSS OF FUNDS or worse       *\n"
+	" *                !USE AT YOUR OWN RISK!               *\n"
+	" *******************************************************/\n\n";
+
+}
+
+pair<string, shared_ptr<yul::Object const>> IRGenerator::run(ContractDefinition const& _contract)
 {
 	string const ir = yul::reindent(generate(_contract));
 
@@ -58,15 +72,13 @@ pair<string, string> IRGenerator::run(ContractDefinition const& _contract)
 	}
 	asmStack.optimize();
 
-	string warning =
-		"/*******************************************************\n"
-		" *                       WARNING                       *\n"
-		" *  Solidity to Yul compilation is still EXPERIMENTAL  *\n"
-		" *       It can result in LOSS OF FUNDS or worse       *\n"
-		" *                !USE AT YOUR OWN RISK!               *\n"
-		" *******************************************************/\n\n";
+	// The optimized IR is only printed if it is requested.
+	return {c_warning + ir, asmStack.parserResult()};
+}
 
-	return {warning + ir, warning + asmStack.print()};
+string IRGenerator::print(yul::Object const& _object)
+{
+	return c_warning + _object.toString(false) + "\n";
 }
 
 string IRGenerator::generate(ContractDefinition const& _contract)
@@ -27,8 +27,14 @@
 #include <libsolidity/codegen/ir/IRGenerationContext.h>
 #include <libsolidity/codegen/YulUtilFunctions.h>
 #include <liblangutil/EVMVersion.h>
+#include <memory>
 #include <string>
 
+namespace yul
+{
+struct Object;
+}
+
 namespace dev
 {
 namespace solidity
@@ -46,9 +52,12 @@ public:
 		m_utils(_evmVersion, m_context.functionCollector())
 	{}
 
-	/// Generates and returns the IR code, in unoptimized and optimized form
-	/// (or just pretty-printed, depending on the optimizer settings).
-	std::pair<std::string, std::string> run(ContractDefinition const& _contract);
+	/// Generates and returns the IR code and the parsed and analyzed IR object,
+	/// which is optimized depending on the optimizer settings.
+	std::pair<std::string, std::shared_ptr<yul::Object const>> run(ContractDefinition const& _contract);
+
+	/// @returns the text representation of an IR object returned by run.
+	static std::string print(yul::Object const& _object);
 
 private:
 	std::string generate(ContractDefinition const& _contract);
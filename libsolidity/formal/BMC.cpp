@@ -27,10 +27,15 @@ using namespace dev;
 using namespace langutil;
 using namespace dev::solidity;
 
-BMC::BMC(smt::EncodingContext& _context, ErrorReporter& _errorReporter, map<h256, string> const& _smtlib2Responses):
+BMC::BMC(
+	smt::EncodingContext& _context,
+	ErrorReporter& _errorReporter,
+	map<h256, string> const& _smtlib2Responses,
+	smt::QueryCache& _queryCache
+):
 	SMTEncoder(_context),
 	m_outerErrorReporter(_errorReporter),
-	m_interface(make_shared<smt::SMTPortfolio>(_smtlib2Responses))
+	m_interface(make_shared<smt::SMTPortfolio>(_smtlib2Responses, _queryCache))
 {
 #if defined (HAVE_Z3) || defined (HAVE_CVC4)
 	if (!_smtlib2Responses.empty())
@@ -714,9 +719,6 @@ void BMC::checkCondition(
 	smt::Expression const* _additionalValue
 )
 {
-	m_interface->push();
-	m_interface->addAssertion(_condition);
-
 	vector<smt::Expression> expressionsToEvaluate;
 	vector<string> expressionNames;
 	tie(expressionsToEvaluate, expressionNames) = _modelExpressions;
@@ -731,7 +733,7 @@ void BMC::checkCondition(
 	}
 	smt::CheckResult result;
 	vector<string> values;
-	tie(result, values) = checkSatisfiableAndGenerateModel(expressionsToEvaluate);
+	tie(result, values) = checkSatisfiableAndGenerateModel({_condition}, expressionsToEvaluate);
 
 	string extraComment = SMTEncoder::extraComment();
 	if (m_loopExecutionHappened)
@@ -793,8 +795,6 @@ void BMC::checkCondition(
 		m_errorReporter.warning(_location, "Error trying to invoke SMT solver.");
 		break;
 	}
-
-	m_interface->pop();
 }
 
 void BMC::checkBooleanNotConstant(
@@ -809,15 +809,8 @@ void BMC::checkBooleanNotConstant(
 	if (dynamic_cast<Literal const*>(&_condition))
 		return;
 
-	m_interface->push();
-	m_interface->addAssertion(_constraints && _value);
-	auto positiveResult = checkSatisfiable();
-	m_interface->pop();
-
-	m_interface->push();
-	m_interface->addAssertion(_constraints && !_value);
-	auto negatedResult = checkSatisfiable();
-	m_interface->pop();
+	auto positiveResult = checkSatisfiable(_constraints && _value);
+	auto negatedResult = checkSatisfiable(_constraints && !_value);
 
 	if (positiveResult == smt::CheckResult::ERROR || negatedResult == smt::CheckResult::ERROR)
 		m_errorReporter.warning(_condition.location(), "Error trying to invoke SMT solver.");
@@ -855,14 +848,16 @@ void BMC::checkBooleanNotConstant(
 	}
 }
 
-pair<smt::CheckResult, vector<string>>
-BMC::checkSatisfiableAndGenerateModel(vector<smt::Expression> const& _expressionsToEvaluate)
+pair<smt::CheckResult, vector<string>> BMC::checkSatisfiableAndGenerateModel(
+	vector<smt::Expression> const& _assumptions,
+	vector<smt::Expression> const& _expressionsToEvaluate
+)
 {
 	smt::CheckResult result;
 	vector<string> values;
 	try
 	{
-		tie(result, values) = m_interface->check(_expressionsToEvaluate);
+		tie(result, values) = m_interface->checkAssuming(_assumptions, _expressionsToEvaluate);
 	}
 	catch (smt::SolverError const& _e)
 	{
@@ -886,8 +881,8 @@ BMC::checkSatisfiableAndGenerateModel(vector<smt::Expression> const& _expression
 	return make_pair(result, values);
 }
 
-smt::CheckResult BMC::checkSatisfiable()
+smt::CheckResult BMC::checkSatisfiable(smt::Expression const& _assumption)
 {
-	return checkSatisfiableAndGenerateModel({}).first;
+	return checkSatisfiableAndGenerateModel({_assumption}, {}).first;
 }
 
@@ -53,7 +53,12 @@ namespace solidity
 class BMC: public SMTEncoder
 {
 public:
-	BMC(smt::EncodingContext& _context, langutil::ErrorReporter& _errorReporter, std::map<h256, std::string> const& _smtlib2Responses);
+	BMC(
+		smt::EncodingContext& _context,
+		langutil::ErrorReporter& _errorReporter,
+		std::map<h256, std::string> const& _smtlib2Responses,
+		smt::QueryCache& _queryCache
+	);
 
 	void analyze(SourceUnit const& _sources, std::shared_ptr<langutil::Scanner> const& _scanner);
 
@@ -160,10 +165,14 @@ private:
 		std::vector<CallStackEntry> const& _callStack,
 		std::string const& _description
 	);
-	std::pair<smt::CheckResult, std::vector<std::string>>
-	checkSatisfiableAndGenerateModel(std::vector<smt::Expression> const& _expressionsToEvaluate);
+	/// Checks whether the current assertions together with @a _assumptions
+	/// are satisfiable. The assumptions are not kept in the solver.
+	std::pair<smt::CheckResult, std::vector<std::string>> checkSatisfiableAndGenerateModel(
+		std::vector<smt::Expression> const& _assumptions,
+		std::vector<smt::Expression> const& _expressionsToEvaluate
+	);
 
-	smt::CheckResult checkSatisfiable();
+	smt::CheckResult checkSatisfiable(smt::Expression const& _assumption);
 	//@}
 
 	/// Flags used for better warning messages.
@@ -47,6 +47,8 @@ void SMTLib2Interface::reset()
 {
 	m_accumulatedOutput.clear();
 	m_accumulatedOutput.emplace_back();
+	m_queryKeys.clear();
+	m_queryKeys.emplace_back();
 	m_variables.clear();
 	write("(set-option :produce-models true)");
 	write("(set-logic QF_UFLIA)");
@@ -55,12 +57,14 @@ void SMTLib2Interface::reset()
 void SMTLib2Interface::push()
 {
 	m_accumulatedOutput.emplace_back();
+	m_queryKeys.push_back(m_queryKeys.back());
 }
 
 void SMTLib2Interface::pop()
 {
 	solAssert(!m_accumulatedOutput.empty(), "");
 	m_accumulatedOutput.pop_back();
+	m_queryKeys.pop_back();
 }
 
 void SMTLib2Interface::declareVariable(string const& _name, Sort const& _sort)
@@ -103,10 +107,7 @@ void SMTLib2Interface::addAssertion(Expression const& _expr)
 
 pair<CheckResult, vector<string>> SMTLib2Interface::check(vector<Expression> const& _expressionsToEvaluate)
 {
-	string response = querySolver(
-		boost::algorithm::join(m_accumulatedOutput, "\n") +
-		checkSatAndGetValuesCommand(_expressionsToEvaluate)
-	);
+	string response = querySolver(dumpQuery({}, _expressionsToEvaluate));
 
 	CheckResult result;
 	// TODO proper parsing
@@ -125,6 +126,39 @@ pair<CheckResult, vector<string>> SMTLib2Interface::check(vector<Expression> con
 	return make_pair(result, values);
 }
 
+string SMTLib2Interface::dumpQuery(
+	vector<Expression> const& _assumptions,
+	vector<Expression> const& _expressionsToEvaluate
+)
+{
+	// This has to match what the default implementation of checkAssuming
+	// sends to the solver, i.e. the assumptions are asserted in a new context.
+	if (!_assumptions.empty())
+	{
+		push();
+		for (auto const& assumption: _assumptions)
+			addAssertion(assumption);
+	}
+	string query =
+		boost::algorithm::join(m_accumulatedOutput, "\n") +
+		checkSatAndGetValuesCommand(_expressionsToEvaluate);
+	if (!_assumptions.empty())
+		pop();
+	return query;
+}
+
+h256 SMTLib2Interface::queryKey(
+	vector<Expression> const& _assumptions,
+	vector<Expression> const& _expressionsToEvaluate
+)
+{
+	solAssert(!m_queryKeys.empty(), "");
+	h256 key = m_queryKeys.back();
+	for (auto const& assumption: _assumptions)
+		key = extendQueryKey(key, "(assert " + toSExpr(assumption) + ")\n");
+	return extendQueryKey(key, checkSatAndGetValuesCommand(_expressionsToEvaluate));
+}
+
 string SMTLib2Interface::toSExpr(Expression const& _expr)
 {
 	if (_expr.arguments.empty())
@@ -166,7 +200,17 @@ string SMTLib2Interface::toSmtLibSort(vector<SortPointer> const& _sorts)
 void SMTLib2Interface::write(string _data)
 {
 	solAssert(!m_accumulatedOutput.empty(), "");
-	m_accumulatedOutput.back() += move(_data) + "\n";
+	solAssert(m_queryKeys.size() == m_accumulatedOutput.size(), "");
+	_data += "\n";
+	m_queryKeys.back() = extendQueryKey(m_queryKeys.back(), _data);
+	m_accumulatedOutput.back() += move(_data);
+}
+
+h256 SMTLib2Interface::extendQueryKey(h256 const& _key, string const& _data)
+{
+	bytes input = _key.asBytes();
+	input.insert(input.end(), _data.begin(), _data.end());
+	return keccak256(input);
 }
 
 string SMTLib2Interface::checkSatAndGetValuesCommand(vector<Expression> const& _expressionsToEvaluate)
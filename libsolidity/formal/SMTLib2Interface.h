@@ -55,6 +55,23 @@ public:
 
 	std::vector<std::string> unhandledQueries() override { return m_unhandledQueries; }
 
+	/// @returns the SMT-LIB2 text that would be sent to the solver when checking
+	/// the current assertions together with @a _assumptions.
+	/// The result is canonical in the sense that it is exactly the input
+	/// of @a checkAssuming and can be used to identify the query.
+	std::string dumpQuery(
+		std::vector<Expression> const& _assumptions,
+		std::vector<Expression> const& _expressionsToEvaluate
+	);
+
+	/// @returns a hash that identifies the query @a dumpQuery would return for the
+	/// same arguments. It is derived from a key that is extended with every command
+	/// as it is written and restored on pop, so the query text is not rendered.
+	h256 queryKey(
+		std::vector<Expression> const& _assumptions,
+		std::vector<Expression> const& _expressionsToEvaluate
+	);
+
 private:
 	void declareFunction(std::string const&, Sort const&);
 
@@ -63,6 +80,8 @@ private:
 	std::string toSmtLibSort(std::vector<SortPointer> const& _sort);
 
 	void write(std::string _data);
+	/// @returns the key of a query that consists of the query identified by @a _key followed by @a _data.
+	static h256 extendQueryKey(h256 const& _key, std::string const& _data);
 
 	std::string checkSatAndGetValuesCommand(std::vector<Expression> const& _expressionsToEvaluate);
 	std::vector<std::string> parseValues(std::string::const_iterator _start, std::string::const_iterator _end);
@@ -71,6 +90,8 @@ private:
 	std::string querySolver(std::string const& _input);
 
 	std::vector<std::string> m_accumulatedOutput;
+	/// Key of the commands written so far, one entry per element of @a m_accumulatedOutput.
+	std::vector<h256> m_queryKeys;
 	std::set<std::string> m_variables;
 
 	std::map<h256, std::string> const& m_queryResponses;
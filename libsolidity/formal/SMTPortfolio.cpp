@@ -30,7 +30,8 @@ using namespace dev;
 using namespace dev::solidity;
 using namespace dev::solidity::smt;
 
-SMTPortfolio::SMTPortfolio(map<h256, string> const& _smtlib2Responses)
+SMTPortfolio::SMTPortfolio(map<h256, string> const& _smtlib2Responses, QueryCache& _queryCache):
+	m_queryCache(_queryCache)
 {
 	m_solvers.emplace_back(make_unique<smt::SMTLib2Interface>(_smtlib2Responses));
 #ifdef HAVE_Z3
@@ -71,6 +72,11 @@ void SMTPortfolio::addAssertion(Expression const& _expr)
 		s->addAssertion(_expr);
 }
 
+pair<CheckResult, vector<string>> SMTPortfolio::check(vector<Expression> const& _expressionsToEvaluate)
+{
+	return checkAssuming({}, _expressionsToEvaluate);
+}
+
 /*
  * Broadcasts the SMT query to all solvers and returns a single result.
  * This comment explains how this result is decided.
@@ -100,16 +106,31 @@ void SMTPortfolio::addAssertion(Expression const& _expr)
  *   when it is told that this is a hard query to solve.
  *
  *   If all solvers return ERROR, the result is ERROR.
+ *
+ * Only actual answers (SAT or UNSAT) are stored in the query cache.
 */
-pair<CheckResult, vector<string>> SMTPortfolio::check(vector<Expression> const& _expressionsToEvaluate)
+pair<CheckResult, vector<string>> SMTPortfolio::checkAssuming(
+	vector<Expression> const& _assumptions,
+	vector<Expression> const& _expressionsToEvaluate
+)
 {
+	// This code assumes that the constructor guarantees that
+	// SmtLib2Interface is in position 0.
+	solAssert(!m_solvers.empty(), "");
+	auto smtlib2 = dynamic_cast<smt::SMTLib2Interface*>(m_solvers.front().get());
+	solAssert(smtlib2, "");
+	h256 queryHash = smtlib2->queryKey(_assumptions, _expressionsToEvaluate);
+	auto cached = m_queryCache.find(queryHash);
+	if (cached != m_queryCache.end())
+		return cached->second;
+
 	CheckResult lastResult = CheckResult::ERROR;
 	vector<string> finalValues;
 	for (auto const& s: m_solvers)
 	{
 		CheckResult result;
 		vector<string> values;
-		tie(result, values) = s->check(_expressionsToEvaluate);
+		tie(result, values) = s->checkAssuming(_assumptions, _expressionsToEvaluate);
 		if (solverAnswered(result))
 		{
 			if (!solverAnswered(lastResult))
@@ -126,6 +147,8 @@ pair<CheckResult, vector<string>> SMTPortfolio::check(vector<Expression> const&
 		else if (result == CheckResult::UNKNOWN && lastResult == CheckResult::ERROR)
 			lastResult = result;
 	}
+	if (solverAnswered(lastResult))
+		m_queryCache[queryHash] = make_pair(lastResult, finalValues);
 	return make_pair(lastResult, finalValues);
 }
 
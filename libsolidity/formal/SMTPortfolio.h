@@ -38,11 +38,15 @@ namespace smt
  * propagating the functionalities to all solvers.
  * It also checks whether different solvers give conflicting answers
  * to SMT queries.
+ * Answered queries are stored in a cache that is indexed by a hash of
+ * their SMT-LIB2 representation, which the SMT-LIB2 interface maintains
+ * incrementally as commands are added. The cache can outlive the portfolio,
+ * so that repeated queries do not reach the solvers again.
  */
 class SMTPortfolio: public SolverInterface, public boost::noncopyable
 {
 public:
-	SMTPortfolio(std::map<h256, std::string> const& _smtlib2Responses);
+	SMTPortfolio(std::map<h256, std::string> const& _smtlib2Responses, QueryCache& _queryCache);
 
 	void reset() override;
 
@@ -54,6 +58,10 @@ public:
 	void addAssertion(Expression const& _expr) override;
 
 	std::pair<CheckResult, std::vector<std::string>> check(std::vector<Expression> const& _expressionsToEvaluate) override;
+	std::pair<CheckResult, std::vector<std::string>> checkAssuming(
+		std::vector<Expression> const& _assumptions,
+		std::vector<Expression> const& _expressionsToEvaluate
+	) override;
 
 	std::vector<std::string> unhandledQueries() override;
 	unsigned solvers() override { return m_solvers.size(); }
@@ -63,6 +71,8 @@ private:
 	std::vector<std::unique_ptr<smt::SolverInterface>> m_solvers;
 
 	std::vector<Expression> m_assertions;
+
+	QueryCache& m_queryCache;
 };
 
 }
@@ -21,6 +21,7 @@
 #include <liblangutil/Exceptions.h>
 #include <libdevcore/Common.h>
 #include <libdevcore/Exceptions.h>
+#include <libdevcore/FixedHash.h>
 
 #include <boost/noncopyable.hpp>
 #include <cstdio>
@@ -290,6 +291,10 @@ private:
 
 DEV_SIMPLE_EXCEPTION(SolverError);
 
+/// Answers to previously solved queries, indexed by the keccak256 hash
+/// of their canonical SMT-LIB2 representation.
+using QueryCache = std::map<h256, std::pair<CheckResult, std::vector<std::string>>>;
+
 class SolverInterface
 {
 public:
@@ -315,6 +320,23 @@ public:
 	virtual std::pair<CheckResult, std::vector<std::string>>
 	check(std::vector<Expression> const& _expressionsToEvaluate) = 0;
 
+	/// Checks for satisfiability of the current assertions together with
+	/// @a _assumptions, which are not kept after the query.
+	/// Solvers that support assumptions natively should override this,
+	/// the default implementation asserts them in a temporary context.
+	virtual std::pair<CheckResult, std::vector<std::string>>
+	checkAssuming(std::vector<Expression> const& _assumptions, std::vector<Expression> const& _expressionsToEvaluate)
+	{
+		// An empty context would still change the query sent by SMT-LIB2 solvers.
+		if (_assumptions.empty())
+			return check(_expressionsToEvaluate);
+		push();
+		ScopeGuard popAssumptions([&]() { pop(); });
+		for (auto const& assumption: _assumptions)
+			addAssertion(assumption);
+		return check(_expressionsToEvaluate);
+	}
+
 	/// @returns a list of queries that the system was not able to respond to.
 	virtual std::vector<std::string> unhandledQueries() { return {}; }
 
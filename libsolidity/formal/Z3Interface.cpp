@@ -74,12 +74,23 @@ void Z3Interface::addAssertion(Expression const& _expr)
 }
 
 pair<CheckResult, vector<string>> Z3Interface::check(vector<Expression> const& _expressionsToEvaluate)
+{
+	return checkAssuming({}, _expressionsToEvaluate);
+}
+
+pair<CheckResult, vector<string>> Z3Interface::checkAssuming(
+	vector<Expression> const& _assumptions,
+	vector<Expression> const& _expressionsToEvaluate
+)
 {
 	CheckResult result;
 	vector<string> values;
 	try
 	{
-		switch (m_solver.check())
+		z3::expr_vector assumptions(m_context);
+		for (auto const& assumption: _assumptions)
+			assumptions.push_back(toZ3Expr(assumption));
+		switch (m_solver.check(assumptions))
 		{
 		case z3::check_result::sat:
 			result = CheckResult::SATISFIABLE;
@@ -42,6 +42,12 @@ public:
 
 	void addAssertion(Expression const& _expr) override;
 	std::pair<CheckResult, std::vector<std::string>> check(std::vector<Expression> const& _expressionsToEvaluate) override;
+	/// Uses Z3's native assumption mechanism, which keeps the learned
+	/// state of the solver instead of creating a new context per query.
+	std::pair<CheckResult, std::vector<std::string>> checkAssuming(
+		std::vector<Expression> const& _assumptions,
+		std::vector<Expression> const& _expressionsToEvaluate
+	) override;
 
 private:
 	void declareFunction(std::string const& _name, Sort const& _sort);
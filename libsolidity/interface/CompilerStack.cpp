@@ -69,6 +69,8 @@
 
 #include <boost/algorithm/string.hpp>
 
+#include <mutex>
+
 using namespace std;
 using namespace dev;
 using namespace langutil;
@@ -78,6 +80,7 @@ static int g_compilerStackCounts = 0;
 
 CompilerStack::CompilerStack(ReadCallback::Callback const& _readFile):
 	m_readFile{_readFile},
+	m_generateEvmBytecode{true},
 	m_generateIR{false},
 	m_generateEWasm{false},
 	m_errorList{},
@@ -177,10 +180,13 @@ void CompilerStack::reset(bool _keepSettings)
 		m_remappings.clear();
 		m_libraries.clear();
 		m_evmVersion = langutil::EVMVersion();
+		m_contractsRequiringCode.clear();
+		m_generateEvmBytecode = true;
 		m_generateIR = false;
 		m_generateEWasm = false;
 		m_optimiserSettings = OptimiserSettings::minimal();
 		m_metadataLiteralSources = false;
+		m_smtQueryCache.clear();
 	}
 	m_globalContext.reset();
 	m_scopes.clear();
@@ -191,13 +197,21 @@ void CompilerStack::reset(bool _keepSettings)
 }
 
 void CompilerStack::setSources(StringMap _sources)
+{
+	map<string, shared_ptr<string const>> buffers;
+	for (auto& source: _sources)
+		buffers[source.first] = make_shared<string const>(std::move(source.second));
+	setSourceBuffers(buffers);
+}
+
+void CompilerStack::setSourceBuffers(map<string, shared_ptr<string const>> const& _sources)
 {
 	if (m_stackState == SourcesSet)
 		BOOST_THROW_EXCEPTION(CompilerError() << errinfo_comment("Cannot change sources once set."));
 	if (m_stackState != Empty)
 		BOOST_THROW_EXCEPTION(CompilerError() << errinfo_comment("Must set sources before parsing."));
-	for (auto source: _sources)
-		m_sources[source.first].scanner = make_shared<Scanner>(CharStream(/*content*/std::move(source.second), /*name*/source.first));
+	for (auto const& source: _sources)
+		m_sources[source.first].scanner = make_shared<Scanner>(CharStream(/*content*/source.second, /*name*/source.first));
 	m_stackState = SourcesSet;
 }
 
@@ -231,11 +245,10 @@ bool CompilerStack::parse()
 		else
 		{
 			source.ast->annotation().path = path;
-			for (auto const& newSource: loadMissingSources(*source.ast, path))
+			for (auto& newSource: loadMissingSources(*source.ast, path))
 			{
 				string const& newPath = newSource.first;
-				string const& newContents = newSource.second;
-				m_sources[newPath].scanner = make_shared<Scanner>(CharStream(newContents, newPath));
+				m_sources[newPath].scanner = make_shared<Scanner>(CharStream(std::move(newSource.second), newPath));
 				sourcesToParse.push_back(newPath);
 			}
 		}
@@ -371,7 +384,7 @@ bool CompilerStack::analyze()
 
 		if (noErrors)
 		{
-			ModelChecker modelChecker(m_errorReporter, m_smtlib2Responses);
+			ModelChecker modelChecker(m_errorReporter, m_smtlib2Responses, m_smtQueryCache);
 			for (Source const* source: m_sourceOrder)
 				modelChecker.analyze(*source->ast, source->scanner);
 			m_unhandledSMTLib2Queries += modelChecker.unhandledQueries();
@@ -406,16 +419,22 @@ bool CompilerStack::isRequestedSource(string const& _sourceName) const
 		m_requestedContractNames.count(_sourceName);
 }
 
-bool CompilerStack::isRequestedContract(ContractDefinition const& _contract) const
+namespace
+{
+
+bool isSelectedContract(
+	map<string, set<string>> const& _contractNames,
+	ContractDefinition const& _contract
+)
 {
 	/// In case nothing was specified in outputSelection.
-	if (m_requestedContractNames.empty())
+	if (_contractNames.empty())
 		return true;
 
 	for (auto const& key: vector<string>{"", _contract.sourceUnitName()})
 	{
-		auto const& it = m_requestedContractNames.find(key);
-		if (it != m_requestedContractNames.end())
+		auto const& it = _contractNames.find(key);
+		if (it != _contractNames.end())
 			if (it->second.count(_contract.name()) || it->second.count(""))
 				return true;
 	}
@@ -423,6 +442,18 @@ bool CompilerStack::isRequestedContract(ContractDefinition const& _contract) con
 	return false;
 }
 
+}
+
+bool CompilerStack::isRequestedContract(ContractDefinition const& _contract) const
+{
+	return isSelectedContract(m_requestedContractNames, _contract);
+}
+
+bool CompilerStack::isCodeRequested(ContractDefinition const& _contract) const
+{
+	return isSelectedContract(m_contractsRequiringCode, _contract);
+}
+
 bool CompilerStack::compile()
 {
 	if (m_stackState < AnalysisSuccessful)
@@ -431,12 +462,14 @@ bool CompilerStack::compile()
 
 	// Only compile contracts individually which have been requested.
 	map<ContractDefinition const*, shared_ptr<Compiler const>> otherCompilers;
+	auto yulFunctionCache = make_shared<YulFunctionCache>();
 	for (Source const* source: m_sourceOrder)
 		for (ASTPointer<ASTNode> const& node: source->ast->nodes())
 			if (auto contract = dynamic_cast<ContractDefinition const*>(node.get()))
-				if (isRequestedContract(*contract))
+				if (isRequestedContract(*contract) && isCodeRequested(*contract))
 				{
-					compileContract(*contract, otherCompilers);
+					if (m_generateEvmBytecode)
+						compileContract(*contract, otherCompilers, yulFunctionCache);
 					if (m_generateIR || m_generateEWasm)
 						generateIR(*contract);
 					if (m_generateEWasm)
@@ -563,7 +596,12 @@ string const& CompilerStack::yulIROptimized(string const& _contractName) const
 	if (m_stackState != CompilationSuccessful)
 		BOOST_THROW_EXCEPTION(CompilerError() << errinfo_comment("Compilation was not successful."));
 
-	return contract(_contractName).yulIROptimized;
+	Contract const& c = contract(_contractName);
+	if (!c.yulIROptimized)
+		c.yulIROptimized.reset(new string(
+			c.yulIROptimizedObject ? IRGenerator::print(*c.yulIROptimizedObject) : string()
+		));
+	return *c.yulIROptimized;
 }
 
 string const& CompilerStack::eWasm(string const& _contractName) const
@@ -591,7 +629,7 @@ eth::LinkerObject const& CompilerStack::runtimeObject(string const& _contractNam
 }
 
 /// TODO: cache this string
-string CompilerStack::assemblyString(string const& _contractName, StringMap _sourceCodes) const
+string CompilerStack::assemblyString(string const& _contractName, StringMap const& _sourceCodes) const
 {
 	if (m_stackState != CompilationSuccessful)
 		BOOST_THROW_EXCEPTION(CompilerError() << errinfo_comment("Compilation was not successful."));
@@ -797,10 +835,44 @@ h256 const& CompilerStack::Source::keccak256() const
 	return keccak256HashCached;
 }
 
+namespace
+{
+
+/// Swarm hashes and IPFS URLs of sources, keyed by the keccak256 hash of their content.
+/// They outlive the compiler stack, so that sources which do not change between
+/// compilations are not hashed again. The caches are shared by all compiler stacks
+/// and thus guarded by a mutex. They are cleared when they reach their size limit.
+size_t const c_maxCachedSourceHashes = 4096;
+mutex g_sourceHashesMutex;
+map<h256, h256> g_swarmHashes;
+map<h256, string> g_ipfsUrls;
+
+template <class T, class F>
+T cachedSourceHash(map<h256, T>& _cache, h256 const& _keccak256, F const& _compute)
+{
+	{
+		lock_guard<mutex> lock(g_sourceHashesMutex);
+		auto it = _cache.find(_keccak256);
+		if (it != _cache.end())
+			return it->second;
+	}
+	// Compute the hash without holding the lock, another thread might do the same.
+	T hash = _compute();
+	lock_guard<mutex> lock(g_sourceHashesMutex);
+	if (_cache.size() >= c_maxCachedSourceHashes)
+		_cache.clear();
+	_cache[_keccak256] = hash;
+	return hash;
+}
+
+}
+
 h256 const& CompilerStack::Source::swarmHash() const
 {
 	if (swarmHashCached == h256{})
-		swarmHashCached = dev::bzzr1Hash(scanner->source());
+		swarmHashCached = cachedSourceHash(g_swarmHashes, keccak256(), [&]() {
+			return dev::bzzr1Hash(scanner->source());
+		});
 	return swarmHashCached;
 }
 
@@ -808,7 +880,9 @@ string const& CompilerStack::Source::ipfsUrl() const
 {
 	if (ipfsUrlCached.empty())
 		if (scanner->source().size() < 1024 * 256)
-			ipfsUrlCached = "dweb:/ipfs/" + dev::ipfsHashBase58(scanner->source());
+			ipfsUrlCached = cachedSourceHash(g_ipfsUrls, keccak256(), [&]() {
+				return "dweb:/ipfs/" + dev::ipfsHashBase58(scanner->source());
+			});
 	return ipfsUrlCached;
 }
 
@@ -935,7 +1009,8 @@ bool onlySafeExperimentalFeaturesActivated(set<ExperimentalFeature> const& featu
 
 void CompilerStack::compileContract(
 	ContractDefinition const& _contract,
-	map<ContractDefinition const*, shared_ptr<Compiler const>>& _otherCompilers
+	map<ContractDefinition const*, shared_ptr<Compiler const>>& _otherCompilers,
+	shared_ptr<YulFunctionCache> const& _yulFunctionCache
 )
 {
 	solAssert(m_stackState >= AnalysisSuccessful, "");
@@ -943,11 +1018,11 @@ void CompilerStack::compileContract(
 	if (_otherCompilers.count(&_contract) || !_contract.canBeDeployed())
 		return;
 	for (auto const* dependency: _contract.annotation().contractDependencies)
-		compileContract(*dependency, _otherCompilers);
+		compileContract(*dependency, _otherCompilers, _yulFunctionCache);
 
 	Contract& compiledContract = m_contracts.at(_contract.fullyQualifiedName());
 
-	shared_ptr<Compiler> compiler = make_shared<Compiler>(m_evmVersion, m_optimiserSettings);
+	shared_ptr<Compiler> compiler = make_shared<Compiler>(m_evmVersion, m_optimiserSettings, _yulFunctionCache);
 	compiledContract.compiler = compiler;
 
 	bytes cborEncodedMetadata = createCBORMetadata(
@@ -1003,25 +1078,21 @@ void CompilerStack::generateIR(ContractDefinition const& _contract)
 		generateIR(*dependency);
 
 	IRGenerator generator(m_evmVersion, m_optimiserSettings);
-	tie(compiledContract.yulIR, compiledContract.yulIROptimized) = generator.run(_contract);
+	tie(compiledContract.yulIR, compiledContract.yulIROptimizedObject) = generator.run(_contract);
 }
 
 void CompilerStack::generateEWasm(ContractDefinition const& _contract)
 {
 	solAssert(m_stackState >= AnalysisSuccessful, "");
 	Contract& compiledContract = m_contracts.at(_contract.fullyQualifiedName());
-	solAssert(!compiledContract.yulIROptimized.empty(), "");
 	if (!compiledContract.eWasm.empty())
 		return;
+	solAssert(compiledContract.yulIROptimizedObject, "");
 
-	// Re-parse the Yul IR in EVM dialect
-	yul::AssemblyStack evmStack(m_evmVersion, yul::AssemblyStack::Language::StrictAssembly, m_optimiserSettings);
-	evmStack.parseAndAnalyze("", compiledContract.yulIROptimized);
-
-	// Turn into eWasm dialect
+	// Turn the analyzed Yul IR into eWasm dialect
 	yul::Object ewasmObject = yul::EVMToEWasmTranslator(
 		yul::EVMDialect::strictAssemblyForEVMObjects(m_evmVersion)
-	).run(*evmStack.parserResult());
+	).run(*compiledContract.yulIROptimizedObject);
 
 	// Re-inject into an assembly stack for the eWasm dialect
 	yul::AssemblyStack ewasmStack(m_evmVersion, yul::AssemblyStack::Language::EWasm, m_optimiserSettings);
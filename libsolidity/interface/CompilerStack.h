@@ -23,6 +23,7 @@
 
 #pragma once
 
+#include <libsolidity/formal/SolverInterface.h>
 #include <libsolidity/interface/ReadFile.h>
 #include <libsolidity/interface/OptimiserSettings.h>
 #include <libsolidity/interface/Version.h>
@@ -51,6 +52,11 @@ namespace langutil
 class Scanner;
 }
 
+namespace yul
+{
+struct Object;
+}
+
 namespace dev
 {
 
@@ -73,6 +79,7 @@ class Compiler;
 class GlobalContext;
 class Natspec;
 class DeclarationContainer;
+struct YulFunctionCache;
 
 /**
  * Easy to use and self-contained Solidity compiler with as few header dependencies as possible.
@@ -155,6 +162,17 @@ public:
 		m_requestedContractNames = _contractNames;
 	}
 
+	/// Sets the contracts for which code has to be generated, in the same format as
+	/// for setRequestedContractNames. The other requested contracts are only analyzed.
+	/// If empty, code is generated for every requested contract.
+	void setContractsRequiringCode(std::map<std::string, std::set<std::string>> const& _contractNames = std::map<std::string, std::set<std::string>>{})
+	{
+		m_contractsRequiringCode = _contractNames;
+	}
+
+	/// Enable generation of EVM bytecode. Enabled by default.
+	void enableEvmBytecodeGeneration(bool _enable = true) { m_generateEvmBytecode = _enable; }
+
 	/// Enable experimental generation of Yul IR code.
 	void enableIRGeneration(bool _enable = true) { m_generateIR = _enable; }
 
@@ -166,7 +184,12 @@ public:
 	void useMetadataLiteralSources(bool _metadataLiteralSources);
 
 	/// Sets the sources. Must be set before parsing.
+	/// The contents are moved into the scanners, so pass an rvalue if
+	/// the map is not needed anymore to avoid copying the sources.
 	void setSources(StringMap _sources);
+	/// Sets the sources from buffers that are shared with the caller instead of copied.
+	/// Must be set before parsing.
+	void setSourceBuffers(std::map<std::string, std::shared_ptr<std::string const>> const& _sources);
 
 	/// Adds a response to an SMTLib2 query (identified by the hash of the query input).
 	/// Must be set before parsing.
@@ -223,7 +246,8 @@ public:
 	/// @returns the IR representation of a contract.
 	std::string const& yulIR(std::string const& _contractName) const;
 
-	/// @returns the optimized IR representation of a contract.
+	/// @returns the optimized IR representation of a contract. It is printed on the first
+	/// request, which has to happen before the YulStringRepository is reset.
 	std::string const& yulIROptimized(std::string const& _contractName) const;
 
 	/// @returns the eWasm (text) representation of a contract.
@@ -252,7 +276,7 @@ public:
 	/// @return a verbose text representation of the assembly.
 	/// @arg _sourceCodes is the map of input files to source code strings
 	/// Prerequisite: Successful compilation.
-	std::string assemblyString(std::string const& _contractName, StringMap _sourceCodes = StringMap()) const;
+	std::string assemblyString(std::string const& _contractName, StringMap const& _sourceCodes = StringMap()) const;
 
 	/// @returns a JSON representation of the assembly.
 	/// @arg _sourceCodes is the map of input files to source code strings
@@ -305,7 +329,11 @@ private:
 		eth::LinkerObject object; ///< Deployment object (includes the runtime sub-object).
 		eth::LinkerObject runtimeObject; ///< Runtime object.
 		std::string yulIR; ///< Experimental Yul IR code.
-		std::string yulIROptimized; ///< Optimized experimental Yul IR code.
+		/// Optimized experimental Yul IR, parsed and analyzed.
+		/// It refers to YulStrings, so it is only valid until the YulStringRepository is reset.
+		std::shared_ptr<yul::Object const> yulIROptimizedObject;
+		/// Optimized experimental Yul IR code, only printed from the object when it is requested.
+		mutable std::unique_ptr<std::string const> yulIROptimized;
 		std::string eWasm; ///< Experimental eWasm code (text representation).
 		mutable std::unique_ptr<std::string const> metadata; ///< The metadata json that will be hashed into the chain.
 		mutable std::unique_ptr<Json::Value const> abi;
@@ -328,12 +356,17 @@ private:
 	/// @returns true if the contract is requested to be compiled.
 	bool isRequestedContract(ContractDefinition const& _contract) const;
 
+	/// @returns true if code has to be generated for the requested contract.
+	bool isCodeRequested(ContractDefinition const& _contract) const;
+
 	/// Compile a single contract.
 	/// @param _otherCompilers provides access to compilers of other contracts, to get
 	///                        their bytecode if needed. Only filled after they have been compiled.
+	/// @param _yulFunctionCache ABI functions generated for the contracts compiled so far.
 	void compileContract(
 		ContractDefinition const& _contract,
-		std::map<ContractDefinition const*, std::shared_ptr<Compiler const>>& _otherCompilers
+		std::map<ContractDefinition const*, std::shared_ptr<Compiler const>>& _otherCompilers,
+		std::shared_ptr<YulFunctionCache> const& _yulFunctionCache
 	);
 
 	/// Generate Yul IR for a single contract.
@@ -395,6 +428,8 @@ private:
 	OptimiserSettings m_optimiserSettings;
 	langutil::EVMVersion m_evmVersion;
 	std::map<std::string, std::set<std::string>> m_requestedContractNames;
+	std::map<std::string, std::set<std::string>> m_contractsRequiringCode;
+	bool m_generateEvmBytecode;
 	bool m_generateIR;
 	bool m_generateEWasm;
 	std::map<std::string, h160> m_libraries;
@@ -404,6 +439,9 @@ private:
 	std::map<std::string const, Source> m_sources;
 	std::vector<std::string> m_unhandledSMTLib2Queries;
 	std::map<h256, std::string> m_smtlib2Responses;
+	/// Answers of the SMT solvers, kept when the stack is reset with its settings
+	/// so that unchanged code is not re-checked by the SMTChecker.
+	smt::QueryCache m_smtQueryCache;
 	std::shared_ptr<GlobalContext> m_globalContext;
 	std::vector<Source const*> m_sourceOrder;
 	/// This is updated during compilation.
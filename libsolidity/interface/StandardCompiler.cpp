@@ -74,6 +74,13 @@ Json::Value formatFatalError(string const& _type, string const& _message)
 	return output;
 }
 
+/// Writes all members of the object @a _object to @a _output.
+void writeMembers(JsonObjectWriter& _output, Json::Value const& _object)
+{
+	for (auto const& name: _object.getMemberNames())
+		_output.write(name, _object[name]);
+}
+
 Json::Value formatSourceLocation(SourceLocation const* location)
 {
 	Json::Value sourceLocation;
@@ -219,30 +226,60 @@ bool isArtifactRequested(Json::Value const& _outputSelection, string const& _fil
 	return false;
 }
 
-/// @returns true if any binary was requested, i.e. we actually have to perform compilation.
-bool isBinaryRequested(Json::Value const& _outputSelection)
+// This does not inculde "evm.methodIdentifiers" on purpose!
+vector<string> const c_evmOutputs{
+	"*",
+	"evm.deployedBytecode", "evm.deployedBytecode.object", "evm.deployedBytecode.opcodes",
+	"evm.deployedBytecode.sourceMap", "evm.deployedBytecode.linkReferences",
+	"evm.bytecode", "evm.bytecode.object", "evm.bytecode.opcodes", "evm.bytecode.sourceMap",
+	"evm.bytecode.linkReferences",
+	"evm.gasEstimates", "evm.legacyAssembly", "evm.assembly"
+};
+
+vector<string> const c_outputsThatRequireBinaries = c_evmOutputs + vector<string>{
+	"ir", "irOptimized",
+	"wast", "wasm", "ewasm.wast", "ewasm.wasm"
+};
+
+/// @returns the contracts for which any of @a _outputs was requested, in the format
+/// used by CompilerStack::setRequestedContractNames.
+map<string, set<string>> contractsRequesting(
+	Json::Value const& _outputSelection,
+	vector<string> const& _outputs
+)
 {
+	map<string, set<string>> contracts;
 	if (!_outputSelection.isObject())
-		return false;
+		return contracts;
 
-	// This does not inculde "evm.methodIdentifiers" on purpose!
-	static vector<string> const outputsThatRequireBinaries{
-		"*",
-		"ir", "irOptimized",
-		"wast", "wasm", "ewasm.wast", "ewasm.wasm",
-		"evm.deployedBytecode", "evm.deployedBytecode.object", "evm.deployedBytecode.opcodes",
-		"evm.deployedBytecode.sourceMap", "evm.deployedBytecode.linkReferences",
-		"evm.bytecode", "evm.bytecode.object", "evm.bytecode.opcodes", "evm.bytecode.sourceMap",
-		"evm.bytecode.linkReferences",
-		"evm.gasEstimates", "evm.legacyAssembly", "evm.assembly"
-	};
+	for (auto const& sourceName: _outputSelection.getMemberNames())
+	{
+		Json::Value const& fileRequests = _outputSelection[sourceName];
+		if (!fileRequests.isObject())
+			continue;
+		for (auto const& contractName: fileRequests.getMemberNames())
+			for (auto const& output: _outputs)
+				if (isArtifactRequested(fileRequests[contractName], output, false))
+				{
+					contracts[sourceName == "*" ? "" : sourceName].insert(
+						contractName == "*" ? "" : contractName
+					);
+					break;
+				}
+	}
+	return contracts;
+}
 
-	for (auto const& fileRequests: _outputSelection)
-		for (auto const& requests: fileRequests)
-			for (auto const& output: outputsThatRequireBinaries)
-				if (isArtifactRequested(requests, output, false))
-					return true;
-	return false;
+/// @returns true if any binary was requested, i.e. we actually have to perform compilation.
+bool isBinaryRequested(Json::Value const& _outputSelection)
+{
+	return !contractsRequesting(_outputSelection, c_outputsThatRequireBinaries).empty();
+}
+
+/// @returns true if any EVM bytecode or assembly was requested.
+bool isEvmBytecodeRequested(Json::Value const& _outputSelection)
+{
+	return !contractsRequesting(_outputSelection, c_evmOutputs).empty();
 }
 
 /// @returns true if any eWasm code was requested. Note that as an exception, '*' does not
@@ -721,12 +758,23 @@ boost::variant<StandardCompiler::InputsAndSettings, Json::Value> StandardCompile
 	return { std::move(ret) };
 }
 
-Json::Value StandardCompiler::compileSolidity(StandardCompiler::InputsAndSettings _inputsAndSettings)
+void StandardCompiler::compileSolidity(InputsAndSettings _inputsAndSettings, JsonObjectWriter& _output)
 {
 	CompilerStack compilerStack(m_readFile);
 
-	StringMap sourceList = std::move(_inputsAndSettings.sources);
-	compilerStack.setSources(sourceList);
+	// The source buffers are shared with the compiler stack. They are only
+	// copied into a map if the assembly is requested, which needs them as strings.
+	map<string, shared_ptr<string const>> sourceBuffers;
+	for (auto& source: _inputsAndSettings.sources)
+		sourceBuffers[source.first] = make_shared<string const>(std::move(source.second));
+	compilerStack.setSourceBuffers(sourceBuffers);
+	StringMap sourceList;
+	auto sourceCodes = [&]() -> StringMap const& {
+		if (sourceList.empty())
+			for (auto const& source: sourceBuffers)
+				sourceList[source.first] = *source.second;
+		return sourceList;
+	};
 	for (auto const& smtLib2Response: _inputsAndSettings.smtLib2Responses)
 		compilerStack.addSMTLib2Response(smtLib2Response.first, smtLib2Response.second);
 	compilerStack.setEVMVersion(_inputsAndSettings.evmVersion);
@@ -736,6 +784,11 @@ Json::Value StandardCompiler::compileSolidity(StandardCompiler::InputsAndSetting
 	compilerStack.setLibraries(_inputsAndSettings.libraries);
 	compilerStack.useMetadataLiteralSources(_inputsAndSettings.metadataLiteralSources);
 	compilerStack.setRequestedContractNames(requestedContractNames(_inputsAndSettings.outputSelection));
+	compilerStack.setContractsRequiringCode(
+		contractsRequesting(_inputsAndSettings.outputSelection, c_outputsThatRequireBinaries)
+	);
+
+	compilerStack.enableEvmBytecodeGeneration(isEvmBytecodeRequested(_inputsAndSettings.outputSelection));
 
 	compilerStack.enableIRGeneration(isIRRequested(_inputsAndSettings.outputSelection));
 
@@ -849,20 +902,109 @@ Json::Value StandardCompiler::compileSolidity(StandardCompiler::InputsAndSetting
 
 	/// Inconsistent state - stop here to receive error reports from users
 	if (((binariesRequested && !compilationSuccess) || !analysisSuccess) && errors.empty())
-		return formatFatalError("InternalCompilerError", "No error reported, but compilation failed.");
-
-	Json::Value output = Json::objectValue;
-
-	if (errors.size() > 0)
-		output["errors"] = std::move(errors);
+	{
+		writeMembers(_output, formatFatalError("InternalCompilerError", "No error reported, but compilation failed."));
+		return;
+	}
 
+	// The members are written in lexicographical order, so that the output can be
+	// streamed one contract at a time. Everything after the contracts is composed
+	// before the "errors" member is written, so that if composing fails, the error
+	// can still be reported in that member.
 	if (!compilerStack.unhandledSMTLib2Queries().empty())
+	{
+		Json::Value auxiliaryInput = Json::objectValue;
 		for (string const& query: compilerStack.unhandledSMTLib2Queries())
-			output["auxiliaryInputRequested"]["smtlib2queries"]["0x" + keccak256(query).hex()] = query;
+			auxiliaryInput["smtlib2queries"]["0x" + keccak256(query).hex()] = query;
+		_output.write("auxiliaryInputRequested", std::move(auxiliaryInput));
+	}
 
 	bool const wildcardMatchesExperimental = false;
 
-	output["sources"] = Json::objectValue;
+	map<string, vector<string>> contractsByFile;
+	for (string const& contractName: analysisSuccess ? compilerStack.contractNames() : vector<string>())
+	{
+		size_t colon = contractName.rfind(':');
+		solAssert(colon != string::npos, "");
+		contractsByFile[contractName.substr(0, colon)].push_back(contractName.substr(colon + 1));
+	}
+
+	_output.beginObject("contracts", true);
+	for (auto const& fileContracts: contractsByFile)
+	{
+		string const& file = fileContracts.first;
+		_output.beginObject(file, true);
+		for (string const& name: fileContracts.second)
+		{
+			string const contractName = file + ":" + name;
+
+			// ABI, documentation and metadata
+			Json::Value contractData(Json::objectValue);
+			if (isArtifactRequested(_inputsAndSettings.outputSelection, file, name, "abi", wildcardMatchesExperimental))
+				contractData["abi"] = compilerStack.contractABI(contractName);
+			if (isArtifactRequested(_inputsAndSettings.outputSelection, file, name, "metadata", wildcardMatchesExperimental))
+				contractData["metadata"] = compilerStack.metadata(contractName);
+			if (isArtifactRequested(_inputsAndSettings.outputSelection, file, name, "userdoc", wildcardMatchesExperimental))
+				contractData["userdoc"] = compilerStack.natspecUser(contractName);
+			if (isArtifactRequested(_inputsAndSettings.outputSelection, file, name, "devdoc", wildcardMatchesExperimental))
+				contractData["devdoc"] = compilerStack.natspecDev(contractName);
+
+			// IR
+			if (compilationSuccess && isArtifactRequested(_inputsAndSettings.outputSelection, file, name, "ir", wildcardMatchesExperimental))
+				contractData["ir"] = compilerStack.yulIR(contractName);
+			if (compilationSuccess && isArtifactRequested(_inputsAndSettings.outputSelection, file, name, "irOptimized", wildcardMatchesExperimental))
+				contractData["irOptimized"] = compilerStack.yulIROptimized(contractName);
+
+			// eWasm
+			if (compilationSuccess && isArtifactRequested(_inputsAndSettings.outputSelection, file, name, "ewasm.wast", wildcardMatchesExperimental))
+				contractData["ewasm"]["wast"] = compilerStack.eWasm(contractName);
+
+			// EVM
+			Json::Value evmData(Json::objectValue);
+			if (compilationSuccess && isArtifactRequested(_inputsAndSettings.outputSelection, file, name, "evm.assembly", wildcardMatchesExperimental))
+				evmData["assembly"] = compilerStack.assemblyString(contractName, sourceCodes());
+			if (compilationSuccess && isArtifactRequested(_inputsAndSettings.outputSelection, file, name, "evm.legacyAssembly", wildcardMatchesExperimental))
+				evmData["legacyAssembly"] = compilerStack.assemblyJSON(contractName, sourceCodes());
+			if (isArtifactRequested(_inputsAndSettings.outputSelection, file, name, "evm.methodIdentifiers", wildcardMatchesExperimental))
+				evmData["methodIdentifiers"] = compilerStack.methodIdentifiers(contractName);
+			if (compilationSuccess && isArtifactRequested(_inputsAndSettings.outputSelection, file, name, "evm.gasEstimates", wildcardMatchesExperimental))
+				evmData["gasEstimates"] = compilerStack.gasEstimates(contractName);
+
+			if (compilationSuccess && isArtifactRequested(
+				_inputsAndSettings.outputSelection,
+				file,
+				name,
+				{ "evm.bytecode", "evm.bytecode.object", "evm.bytecode.opcodes", "evm.bytecode.sourceMap", "evm.bytecode.linkReferences" },
+				wildcardMatchesExperimental
+			))
+				evmData["bytecode"] = collectEVMObject(
+					compilerStack.object(contractName),
+					compilerStack.sourceMapping(contractName)
+				);
+
+			if (compilationSuccess && isArtifactRequested(
+				_inputsAndSettings.outputSelection,
+				file,
+				name,
+				{ "evm.deployedBytecode", "evm.deployedBytecode.object", "evm.deployedBytecode.opcodes", "evm.deployedBytecode.sourceMap", "evm.deployedBytecode.linkReferences" },
+				wildcardMatchesExperimental
+			))
+				evmData["deployedBytecode"] = collectEVMObject(
+					compilerStack.runtimeObject(contractName),
+					compilerStack.runtimeSourceMapping(contractName)
+				);
+
+			if (!evmData.empty())
+				contractData["evm"] = evmData;
+
+			if (!contractData.empty())
+				_output.write(name, std::move(contractData));
+		}
+		_output.endObject();
+	}
+	_output.endObject();
+
+	vector<pair<string, Json::Value>> sourceResults;
 	unsigned sourceIndex = 0;
 	for (string const& sourceName: analysisSuccess ? compilerStack.sourceNames() : vector<string>())
 	{
@@ -872,87 +1014,16 @@ Json::Value StandardCompiler::compileSolidity(StandardCompiler::InputsAndSetting
 			sourceResult["ast"] = ASTJsonConverter(false, compilerStack.sourceIndices()).toJson(compilerStack.ast(sourceName));
 		if (isArtifactRequested(_inputsAndSettings.outputSelection, sourceName, "", "legacyAST", wildcardMatchesExperimental))
 			sourceResult["legacyAST"] = ASTJsonConverter(true, compilerStack.sourceIndices()).toJson(compilerStack.ast(sourceName));
-		output["sources"][sourceName] = sourceResult;
+		sourceResults.emplace_back(sourceName, std::move(sourceResult));
 	}
 
-	Json::Value contractsOutput = Json::objectValue;
-	for (string const& contractName: analysisSuccess ? compilerStack.contractNames() : vector<string>())
-	{
-		size_t colon = contractName.rfind(':');
-		solAssert(colon != string::npos, "");
-		string file = contractName.substr(0, colon);
-		string name = contractName.substr(colon + 1);
-
-		// ABI, documentation and metadata
-		Json::Value contractData(Json::objectValue);
-		if (isArtifactRequested(_inputsAndSettings.outputSelection, file, name, "abi", wildcardMatchesExperimental))
-			contractData["abi"] = compilerStack.contractABI(contractName);
-		if (isArtifactRequested(_inputsAndSettings.outputSelection, file, name, "metadata", wildcardMatchesExperimental))
-			contractData["metadata"] = compilerStack.metadata(contractName);
-		if (isArtifactRequested(_inputsAndSettings.outputSelection, file, name, "userdoc", wildcardMatchesExperimental))
-			contractData["userdoc"] = compilerStack.natspecUser(contractName);
-		if (isArtifactRequested(_inputsAndSettings.outputSelection, file, name, "devdoc", wildcardMatchesExperimental))
-			contractData["devdoc"] = compilerStack.natspecDev(contractName);
-
-		// IR
-		if (compilationSuccess && isArtifactRequested(_inputsAndSettings.outputSelection, file, name, "ir", wildcardMatchesExperimental))
-			contractData["ir"] = compilerStack.yulIR(contractName);
-		if (compilationSuccess && isArtifactRequested(_inputsAndSettings.outputSelection, file, name, "irOptimized", wildcardMatchesExperimental))
-			contractData["irOptimized"] = compilerStack.yulIROptimized(contractName);
-
-		// eWasm
-		if (compilationSuccess && isArtifactRequested(_inputsAndSettings.outputSelection, file, name, "ewasm.wast", wildcardMatchesExperimental))
-			contractData["ewasm"]["wast"] = compilerStack.eWasm(contractName);
-
-		// EVM
-		Json::Value evmData(Json::objectValue);
-		if (compilationSuccess && isArtifactRequested(_inputsAndSettings.outputSelection, file, name, "evm.assembly", wildcardMatchesExperimental))
-			evmData["assembly"] = compilerStack.assemblyString(contractName, sourceList);
-		if (compilationSuccess && isArtifactRequested(_inputsAndSettings.outputSelection, file, name, "evm.legacyAssembly", wildcardMatchesExperimental))
-			evmData["legacyAssembly"] = compilerStack.assemblyJSON(contractName, sourceList);
-		if (isArtifactRequested(_inputsAndSettings.outputSelection, file, name, "evm.methodIdentifiers", wildcardMatchesExperimental))
-			evmData["methodIdentifiers"] = compilerStack.methodIdentifiers(contractName);
-		if (compilationSuccess && isArtifactRequested(_inputsAndSettings.outputSelection, file, name, "evm.gasEstimates", wildcardMatchesExperimental))
-			evmData["gasEstimates"] = compilerStack.gasEstimates(contractName);
-
-		if (compilationSuccess && isArtifactRequested(
-			_inputsAndSettings.outputSelection,
-			file,
-			name,
-			{ "evm.bytecode", "evm.bytecode.object", "evm.bytecode.opcodes", "evm.bytecode.sourceMap", "evm.bytecode.linkReferences" },
-			wildcardMatchesExperimental
-		))
-			evmData["bytecode"] = collectEVMObject(
-				compilerStack.object(contractName),
-				compilerStack.sourceMapping(contractName)
-			);
-
-		if (compilationSuccess && isArtifactRequested(
-			_inputsAndSettings.outputSelection,
-			file,
-			name,
-			{ "evm.deployedBytecode", "evm.deployedBytecode.object", "evm.deployedBytecode.opcodes", "evm.deployedBytecode.sourceMap", "evm.deployedBytecode.linkReferences" },
-			wildcardMatchesExperimental
-		))
-			evmData["deployedBytecode"] = collectEVMObject(
-				compilerStack.runtimeObject(contractName),
-				compilerStack.runtimeSourceMapping(contractName)
-			);
-
-		if (!evmData.empty())
-			contractData["evm"] = evmData;
-
-		if (!contractData.empty())
-		{
-			if (!contractsOutput.isMember(file))
-				contractsOutput[file] = Json::objectValue;
-			contractsOutput[file][name] = contractData;
-		}
-	}
-	if (!contractsOutput.empty())
-		output["contracts"] = contractsOutput;
+	if (errors.size() > 0)
+		_output.write("errors", std::move(errors));
 
-	return output;
+	_output.beginObject("sources");
+	for (auto& sourceResult: sourceResults)
+		_output.write(sourceResult.first, std::move(sourceResult.second));
+	_output.endObject();
 }
 
 
@@ -1034,63 +1105,95 @@ Json::Value StandardCompiler::compileYul(InputsAndSettings _inputsAndSettings)
 
 Json::Value StandardCompiler::compile(Json::Value const& _input) noexcept
 {
-	YulStringRepository::reset();
+	Json::Value output;
+	JsonObjectWriter writer(output);
+	compile(_input, writer);
+	writer.finish();
+	return output;
+}
 
+string StandardCompiler::compile(string const& _input) noexcept
+{
+	ostringstream output;
+	compile(_input, output);
+	return output.str();
+}
+
+void StandardCompiler::compile(string const& _input, ostream& _output) noexcept
+{
+	Json::Value input;
+	string errors;
 	try
 	{
-		auto parsed = parseInput(_input);
-		if (parsed.type() == typeid(Json::Value))
-			return boost::get<Json::Value>(std::move(parsed));
-		InputsAndSettings settings = boost::get<InputsAndSettings>(std::move(parsed));
-		if (settings.language == "Solidity")
-			return compileSolidity(std::move(settings));
-		else if (settings.language == "Yul")
-			return compileYul(std::move(settings));
-		else
-			return formatFatalError("JSONError", "Only \"Solidity\" or \"Yul\" is supported as a language.");
-	}
-	catch (Json::LogicError const& _exception)
-	{
-		return formatFatalError("InternalCompilerError", string("JSON logic exception: ") + _exception.what());
+		if (!jsonParseStrict(_input, input, &errors))
+		{
+			_output << jsonCompactPrint(formatFatalError("JSONError", errors));
+			return;
+		}
 	}
-	catch (Json::RuntimeError const& _exception)
+	catch (...)
 	{
-		return formatFatalError("InternalCompilerError", string("JSON runtime exception: ") + _exception.what());
+		_output << "{\"errors\":[{\"type\":\"JSONError\",\"component\":\"general\",\"severity\":\"error\",\"message\":\"Error parsing input JSON.\"}]}";
+		return;
 	}
-	catch (Exception const& _exception)
+
+	JsonObjectWriter writer(_output);
+	try
 	{
-		return formatFatalError("InternalCompilerError", "Internal exception in StandardCompiler::compile: " + boost::diagnostic_information(_exception));
+		compile(input, writer);
+		writer.finish();
 	}
 	catch (...)
 	{
-		return formatFatalError("InternalCompilerError", "Internal exception in StandardCompiler::compile");
+		// Output that has already been written cannot be taken back.
+		if (writer.discard())
+			_output << "{\"errors\":[{\"type\":\"JSONError\",\"component\":\"general\",\"severity\":\"error\",\"message\":\"Error writing output JSON.\"}]}";
 	}
 }
 
-string StandardCompiler::compile(string const& _input) noexcept
+void StandardCompiler::compile(Json::Value const& _input, JsonObjectWriter& _output) noexcept
 {
-	Json::Value input;
-	string errors;
+	YulStringRepository::reset();
+
+	// If nothing has been streamed yet, the output only consists of the error. Otherwise,
+	// the error is added after the members written so far. This can only happen while
+	// the contracts are written, i.e. before the "errors" member.
+	auto writeFatalError = [&](string const& _type, string const& _message)
+	{
+		if (!_output.discard())
+			_output.endObjects();
+		writeMembers(_output, formatFatalError(_type, _message));
+	};
 	try
 	{
-		if (!jsonParseStrict(_input, input, &errors))
-			return jsonCompactPrint(formatFatalError("JSONError", errors));
+		auto parsed = parseInput(_input);
+		if (parsed.type() == typeid(Json::Value))
+			writeMembers(_output, boost::get<Json::Value>(parsed));
+		else
+		{
+			InputsAndSettings settings = boost::get<InputsAndSettings>(std::move(parsed));
+			if (settings.language == "Solidity")
+				compileSolidity(std::move(settings), _output);
+			else if (settings.language == "Yul")
+				writeMembers(_output, compileYul(std::move(settings)));
+			else
+				writeFatalError("JSONError", "Only \"Solidity\" or \"Yul\" is supported as a language.");
+		}
 	}
-	catch (...)
+	catch (Json::LogicError const& _exception)
 	{
-		return "{\"errors\":[{\"type\":\"JSONError\",\"component\":\"general\",\"severity\":\"error\",\"message\":\"Error parsing input JSON.\"}]}";
+		writeFatalError("InternalCompilerError", string("JSON logic exception: ") + _exception.what());
 	}
-
-	// cout << "Input: " << input.toStyledString() << endl;
-	Json::Value output = compile(input);
-	// cout << "Output: " << output.toStyledString() << endl;
-
-	try
+	catch (Json::RuntimeError const& _exception)
+	{
+		writeFatalError("InternalCompilerError", string("JSON runtime exception: ") + _exception.what());
+	}
+	catch (Exception const& _exception)
 	{
-		return jsonCompactPrint(output);
+		writeFatalError("InternalCompilerError", "Internal exception in StandardCompiler::compile: " + boost::diagnostic_information(_exception));
 	}
 	catch (...)
 	{
-		return "{\"errors\":[{\"type\":\"JSONError\",\"component\":\"general\",\"severity\":\"error\",\"message\":\"Error writing output JSON.\"}]}";
+		writeFatalError("InternalCompilerError", "Internal exception in StandardCompiler::compile");
 	}
 }
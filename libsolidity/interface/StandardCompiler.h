@@ -24,9 +24,13 @@
 
 #include <libsolidity/interface/CompilerStack.h>
 
+#include <libdevcore/JSON.h>
+
 #include <boost/optional.hpp>
 #include <boost/variant.hpp>
 
+#include <ostream>
+
 namespace dev
 {
 
@@ -54,6 +58,9 @@ public:
 	/// Parses input as JSON and peforms the above processing steps, returning a serialized JSON
 	/// output. Parsing errors are returned as regular errors.
 	std::string compile(std::string const& _input) noexcept;
+	/// Same as above, but writes the serialized JSON output to @a _output while it is
+	/// produced, so that it does not have to be kept in memory as a whole.
+	void compile(std::string const& _input, std::ostream& _output) noexcept;
 
 private:
 	struct InputsAndSettings
@@ -75,7 +82,10 @@ private:
 	/// it in condensed form or an error as a json object.
 	boost::variant<InputsAndSettings, Json::Value> parseInput(Json::Value const& _input);
 
-	Json::Value compileSolidity(InputsAndSettings _inputsAndSettings);
+	/// Performs the processing steps and writes the output to @a _output.
+	void compile(Json::Value const& _input, JsonObjectWriter& _output) noexcept;
+
+	void compileSolidity(InputsAndSettings _inputsAndSettings, JsonObjectWriter& _output);
 	Json::Value compileYul(InputsAndSettings _inputsAndSettings);
 
 	ReadCallback::Callback m_readFile;
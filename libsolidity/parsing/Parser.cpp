@@ -30,6 +30,7 @@
 #include <liblangutil/SemVerHandler.h>
 #include <liblangutil/SourceLocation.h>
 #include <libyul/backends/evm/EVMDialect.h>
+#include <libdevcore/Common.h>
 #include <cctype>
 #include <vector>
 
@@ -63,7 +64,13 @@ public:
 		solAssert(m_location.source, "");
 		if (m_location.end < 0)
 			markEndPosition();
-		return make_shared<NodeType>(m_location, std::forward<Args>(_args)...);
+		ASTPointer<NodeType> node = allocate_shared<NodeType>(
+			ArenaAllocator<NodeType>(m_parser.m_arena),
+			m_location,
+			std::forward<Args>(_args)...
+		);
+		node->m_arena = m_parser.m_arena.get();
+		return node;
 	}
 
 	SourceLocation const& location() const noexcept { return m_location; }
@@ -75,6 +82,11 @@ private:
 
 ASTPointer<SourceUnit> Parser::parse(shared_ptr<Scanner> const& _scanner)
 {
+	m_arena = make_shared<Arena>();
+	ScopeGuard releaseArena([&]() {
+		m_internedStrings.clear();
+		m_arena.reset();
+	});
 	try
 	{
 		m_recursionDepth = 0;
@@ -176,7 +188,7 @@ ASTPointer<ImportDirective> Parser::parseImportDirective()
 	ASTNodeFactory nodeFactory(*this);
 	expectToken(Token::Import);
 	ASTPointer<ASTString> path;
-	ASTPointer<ASTString> unitAlias = make_shared<string>();
+	ASTPointer<ASTString> unitAlias = internString({});
 	vector<pair<ASTPointer<Identifier>, ASTPointer<ASTString>>> symbolAliases;
 
 	if (m_scanner->currentToken() == Token::StringLiteral)
@@ -266,7 +278,7 @@ ASTPointer<ContractDefinition> Parser::parseContractDefinition()
 	try
 	{
 		if (m_scanner->currentCommentLiteral() != "")
-			docString = make_shared<ASTString>(m_scanner->currentCommentLiteral());
+			docString = internString(m_scanner->currentCommentLiteral());
 		contractKind = parseContractKind();
 		name = expectIdentifierToken();
 		if (m_scanner->currentToken() == Token::Is)
@@ -422,9 +434,9 @@ Parser::FunctionHeaderParserResult Parser::parseFunctionHeader(bool _forceEmptyN
 	m_scanner->next();
 
 	if (result.isConstructor)
-		result.name = make_shared<ASTString>();
+		result.name = internString({});
 	else if (_forceEmptyName || m_scanner->currentToken() == Token::LParen)
-		result.name = make_shared<ASTString>();
+		result.name = internString({});
 	else if (m_scanner->currentToken() == Token::Constructor)
 		fatalParserError(string(
 			"This function is named \"constructor\" but is not the constructor of the contract. "
@@ -510,7 +522,7 @@ ASTPointer<ASTNode> Parser::parseFunctionDefinitionOrFunctionTypeStateVariable()
 	ASTNodeFactory nodeFactory(*this);
 	ASTPointer<ASTString> docstring;
 	if (m_scanner->currentCommentLiteral() != "")
-		docstring = make_shared<ASTString>(m_scanner->currentCommentLiteral());
+		docstring = internString(m_scanner->currentCommentLiteral());
 
 	FunctionHeaderParserResult header = parseFunctionHeader(false, true);
 
@@ -695,7 +707,7 @@ ASTPointer<VariableDeclaration> Parser::parseVariableDeclaration(
 
 	if (_options.allowEmptyName && m_scanner->currentToken() != Token::Identifier)
 	{
-		identifier = make_shared<ASTString>("");
+		identifier = internString({});
 		solAssert(!_options.allowVar, ""); // allowEmptyName && allowVar makes no sense
 	}
 	else
@@ -734,7 +746,7 @@ ASTPointer<ModifierDefinition> Parser::parseModifierDefinition()
 	ASTNodeFactory nodeFactory(*this);
 	ASTPointer<ASTString> docstring;
 	if (m_scanner->currentCommentLiteral() != "")
-		docstring = make_shared<ASTString>(m_scanner->currentCommentLiteral());
+		docstring = internString(m_scanner->currentCommentLiteral());
 
 	expectToken(Token::Modifier);
 	ASTPointer<ASTString> name(expectIdentifierToken());
@@ -759,7 +771,7 @@ ASTPointer<EventDefinition> Parser::parseEventDefinition()
 	ASTNodeFactory nodeFactory(*this);
 	ASTPointer<ASTString> docstring;
 	if (m_scanner->currentCommentLiteral() != "")
-		docstring = make_shared<ASTString>(m_scanner->currentCommentLiteral());
+		docstring = internString(m_scanner->currentCommentLiteral());
 
 	expectToken(Token::Event);
 	ASTPointer<ASTString> name(expectIdentifierToken());
@@ -1008,7 +1020,7 @@ ASTPointer<Statement> Parser::parseStatement()
 	try
 	{
 		if (m_scanner->currentCommentLiteral() != "")
-			docString = make_shared<ASTString>(m_scanner->currentCommentLiteral());
+			docString = internString(m_scanner->currentCommentLiteral());
 		switch (m_scanner->currentToken())
 		{
 		case Token::If:
@@ -1104,8 +1116,10 @@ ASTPointer<InlineAssembly> Parser::parseInlineAssembly(ASTPointer<ASTString> con
 	if (block == nullptr)
 		BOOST_THROW_EXCEPTION(FatalError());
 
-	location.end = block->location.end;
-	return make_shared<InlineAssembly>(location, _docString, dialect, block);
+	location.end = block->location.end();
+	ASTNodeFactory nodeFactory(*this);
+	nodeFactory.setLocation(location);
+	return nodeFactory.createNode<InlineAssembly>(_docString, dialect, block);
 }
 
 ASTPointer<IfStatement> Parser::parseIfStatement(ASTPointer<ASTString> const& _docString)
@@ -1618,7 +1632,7 @@ ASTPointer<Expression> Parser::parsePrimaryExpression()
 		// Inside expressions "type" is the name of a special, globally-available function.
 		nodeFactory.markEndPosition();
 		m_scanner->next();
-		expression = nodeFactory.createNode<Identifier>(make_shared<ASTString>("type"));
+		expression = nodeFactory.createNode<Identifier>(internString("type"));
 		break;
 	case Token::LParen:
 	case Token::LBrack:
@@ -1843,7 +1857,7 @@ ASTPointer<Expression> Parser::expressionFromIndexAccessStructure(
 		Identifier const& identifier = dynamic_cast<Identifier const&>(*_iap.path[i]);
 		expression = nodeFactory.createNode<MemberAccess>(
 			expression,
-			make_shared<ASTString>(identifier.name())
+			internString(identifier.name())
 		);
 	}
 	for (auto const& index: _iap.indices)
@@ -1871,10 +1885,21 @@ ASTPointer<ASTString> Parser::expectIdentifierToken()
 
 ASTPointer<ASTString> Parser::getLiteralAndAdvance()
 {
-	ASTPointer<ASTString> identifier = make_shared<ASTString>(m_scanner->currentLiteral());
+	ASTPointer<ASTString> identifier = internString(m_scanner->currentLiteral());
 	m_scanner->next();
 	return identifier;
 }
 
+ASTPointer<ASTString> Parser::internString(string const& _value)
+{
+	auto it = m_internedStrings.find(_value);
+	if (it == m_internedStrings.end())
+		it = m_internedStrings.emplace_hint(
+			it,
+			allocate_shared<ASTString>(ArenaAllocator<ASTString>(m_arena), _value)
+		);
+	return *it;
+}
+
 }
 }
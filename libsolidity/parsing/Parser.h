@@ -25,6 +25,9 @@
 #include <libsolidity/ast/AST.h>
 #include <liblangutil/ParserBase.h>
 #include <liblangutil/EVMVersion.h>
+#include <libdevcore/Arena.h>
+
+#include <set>
 
 namespace langutil
 {
@@ -182,6 +185,8 @@ private:
 
 	ASTPointer<ASTString> expectIdentifierToken();
 	ASTPointer<ASTString> getLiteralAndAdvance();
+	/// @returns a string with the given value that is shared by all nodes of the current source unit.
+	ASTPointer<ASTString> internString(std::string const& _value);
 	///@}
 
 	/// Creates an empty ParameterList at the current location (used if parameters can be omitted).
@@ -190,6 +195,22 @@ private:
 	/// Flag that signifies whether '_' is parsed as a PlaceholderStatement or a regular identifier.
 	bool m_insideModifier = false;
 	langutil::EVMVersion m_evmVersion;
+
+	/// Comparator that allows looking up interned strings by value.
+	struct InternedStringLess
+	{
+		using is_transparent = void;
+		bool operator()(ASTPointer<ASTString> const& _a, ASTPointer<ASTString> const& _b) const
+		{
+			return *_a < *_b;
+		}
+		bool operator()(ASTPointer<ASTString> const& _a, std::string const& _b) const { return *_a < _b; }
+		bool operator()(std::string const& _a, ASTPointer<ASTString> const& _b) const { return _a < *_b; }
+	};
+	/// Arena that nodes, annotations and strings of the source unit currently parsed are allocated from.
+	/// Every node keeps it alive, so it is freed in bulk once the whole AST is gone.
+	std::shared_ptr<Arena> m_arena;
+	std::set<ASTPointer<ASTString>, InternedStringLess> m_internedStrings;
 };
 
 }
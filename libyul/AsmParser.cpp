@@ -86,7 +86,7 @@ Block Parser::parseBlock()
 	expectToken(Token::LBrace);
 	while (currentToken() != Token::RBrace)
 		block.statements.emplace_back(parseStatement());
-	block.location.end = endPosition();
+	block.location = block.location.withEnd(endPosition());
 	advance();
 	return block;
 }
@@ -125,7 +125,7 @@ Statement Parser::parseStatement()
 			fatalParserError("Case not allowed after default case.");
 		if (_switch.cases.empty())
 			fatalParserError("Switch statement without any cases.");
-		_switch.location.end = _switch.cases.back().body.location.end;
+		_switch.location = _switch.location.withEnd(_switch.cases.back().body.location.end());
 		return Statement{move(_switch)};
 	}
 	case Token::For:
@@ -157,7 +157,7 @@ Statement Parser::parseStatement()
 			fatalParserError("Identifier expected, got builtin symbol.");
 		else if (instructions().count(assignment.variableName.name.str()))
 			fatalParserError("Identifier expected, got instruction name.");
-		assignment.location.end = endPosition();
+		assignment.location = assignment.location.withEnd(endPosition());
 		expectToken(Token::Identifier);
 		return Statement{move(assignment)};
 	}
@@ -218,7 +218,7 @@ Statement Parser::parseStatement()
 		expectToken(Token::AssemblyAssign);
 
 		assignment.value.reset(new Expression(parseExpression()));
-		assignment.location.end = locationOf(*assignment.value).end;
+		assignment.location = assignment.location.withEnd(locationOf(*assignment.value).end());
 
 		return Statement{std::move(assignment)};
 	}
@@ -279,7 +279,7 @@ Case Parser::parseCase()
 	else
 		solAssert(false, "Case or default case expected.");
 	_case.body = parseBlock();
-	_case.location.end = _case.body.location.end;
+	_case.location = _case.location.withEnd(_case.body.location.end());
 	return _case;
 }
 
@@ -299,7 +299,7 @@ ForLoop Parser::parseForLoop()
 	forLoop.post = parseBlock();
 	m_currentForLoopComponent = ForLoopComponent::ForLoopBody;
 	forLoop.body = parseBlock();
-	forLoop.location.end = forLoop.body.location.end;
+	forLoop.location = forLoop.location.withEnd(forLoop.body.location.end());
 
 	m_currentForLoopComponent = outerForLoopComponent;
 
@@ -448,7 +448,7 @@ Parser::ElementaryOperation Parser::parseElementaryOperation()
 		if (m_dialect.flavour == AsmFlavour::Yul)
 		{
 			expectToken(Token::Colon);
-			literal.location.end = endPosition();
+			literal.location = literal.location.withEnd(endPosition());
 			literal.type = expectAsmIdentifier();
 		}
 		else if (kind == LiteralKind::Boolean)
@@ -483,10 +483,10 @@ VariableDeclaration Parser::parseVariableDeclaration()
 	{
 		expectToken(Token::AssemblyAssign);
 		varDecl.value = make_unique<Expression>(parseExpression());
-		varDecl.location.end = locationOf(*varDecl.value).end;
+		varDecl.location = varDecl.location.withEnd(locationOf(*varDecl.value).end());
 	}
 	else
-		varDecl.location.end = varDecl.variables.back().location.end;
+		varDecl.location = varDecl.location.withEnd(varDecl.variables.back().location.end());
 	return varDecl;
 }
 
@@ -528,7 +528,7 @@ FunctionDefinition Parser::parseFunctionDefinition()
 		}
 	}
 	funDef.body = parseBlock();
-	funDef.location.end = funDef.body.location.end;
+	funDef.location = funDef.location.withEnd(funDef.body.location.end());
 
 	m_currentForLoopComponent = outerForLoopComponent;
 	return funDef;
@@ -579,7 +579,7 @@ Expression Parser::parseCall(Parser::ElementaryOperation&& _initialOp)
 					advance();
 			}
 		}
-		ret.location.end = endPosition();
+		ret.location = ret.location.withEnd(endPosition());
 		if (currentToken() == Token::Comma)
 			fatalParserError(string(
 				"Expected ')' (instruction \"" +
@@ -611,7 +611,7 @@ Expression Parser::parseCall(Parser::ElementaryOperation&& _initialOp)
 				ret.arguments.emplace_back(parseExpression());
 			}
 		}
-		ret.location.end = endPosition();
+		ret.location = ret.location.withEnd(endPosition());
 		expectToken(Token::RParen);
 		return ret;
 	}
@@ -633,7 +633,7 @@ TypedName Parser::parseTypedName()
 	if (m_dialect.flavour == AsmFlavour::Yul)
 	{
 		expectToken(Token::Colon);
-		typedName.location.end = endPosition();
+		typedName.location = typedName.location.withEnd(endPosition());
 		typedName.type = expectAsmIdentifier();
 	}
 	return typedName;
@@ -61,15 +61,16 @@ protected:
 	/// Creates an inline assembly node with the given source location.
 	template <class T> T createWithLocation(langutil::SourceLocation const& _loc = {}) const
 	{
-		T r;
-		r.location = _loc;
-		if (r.location.isEmpty())
+		langutil::SourceLocation location = _loc;
+		if (location.isEmpty())
 		{
-			r.location.start = position();
-			r.location.end = endPosition();
+			location.start = position();
+			location.end = endPosition();
 		}
-		if (!r.location.source)
-			r.location.source = m_scanner->charStream();
+		if (!location.source)
+			location.source = m_scanner->charStream();
+		T r;
+		r.location = location;
 		return r;
 	}
 	langutil::SourceLocation location() const { return {position(), endPosition(), m_scanner->charStream()}; }
@@ -22,6 +22,9 @@
 
 #include <libyul/AsmAnalysis.h>
 #include <libyul/AsmAnalysisInfo.h>
+#include <libyul/AsmData.h>
+
+#include <libyul/optimiser/ASTCopier.h>
 
 #include <libyul/backends/evm/EVMCodeTransform.h>
 #include <libyul/backends/evm/NoOutputAssembly.h>
@@ -71,3 +74,49 @@ map<YulString, int> CompilabilityChecker::run(
 	else
 		return {};
 }
+
+map<YulString, int> CompilabilityChecker::run(
+	Dialect const& _dialect,
+	Block const& _ast,
+	bool _optimizeStackAllocation,
+	set<YulString> const& _functions
+)
+{
+	yulAssert(
+		_ast.statements.size() > 0 && _ast.statements.at(0).type() == typeid(Block),
+		"Need to run the function grouper before checking single functions."
+	);
+
+	// Since functions are not nested, the code generated for a function only depends on
+	// its own body and on the signatures of the functions it calls. All other functions
+	// are replaced by functions with the same signature and an empty body.
+	Block ast{_ast.location, {}};
+	if (_functions.count(YulString{}))
+		ast.statements.emplace_back(ASTCopier{}.translate(_ast.statements.at(0)));
+	else
+		ast.statements.emplace_back(Block{boost::get<Block>(_ast.statements.at(0)).location, {}});
+	for (size_t i = 1; i < _ast.statements.size(); ++i)
+	{
+		FunctionDefinition const& function = boost::get<FunctionDefinition>(_ast.statements.at(i));
+		if (_functions.count(function.name))
+			ast.statements.emplace_back(ASTCopier{}.translate(_ast.statements.at(i)));
+		else
+			ast.statements.emplace_back(FunctionDefinition{
+				function.location,
+				function.name,
+				function.parameters,
+				function.returnVariables,
+				Block{function.body.location, {}}
+			});
+	}
+
+	// Functions with too many parameters or return variables are reported
+	// even if their body is empty.
+	map<YulString, int> functions = run(_dialect, ast, _optimizeStackAllocation);
+	for (auto it = functions.begin(); it != functions.end();)
+		if (_functions.count(it->first))
+			++it;
+		else
+			it = functions.erase(it);
+	return functions;
+}
@@ -25,6 +25,7 @@
 
 #include <map>
 #include <memory>
+#include <set>
 
 namespace yul
 {
@@ -44,6 +45,17 @@ public:
 		Block const& _ast,
 		bool _optimizeStackAllocation
 	);
+
+	/// Performs the same check, but only for the functions named in @a _functions, where
+	/// the empty name denotes the outermost block. Other functions are assumed to be
+	/// compilable and are not analysed.
+	/// Requires the code to be grouped by the FunctionGrouper.
+	static std::map<YulString, int> run(
+		Dialect const& _dialect,
+		Block const& _ast,
+		bool _optimizeStackAllocation,
+		std::set<YulString> const& _functions
+	);
 };
 
 }
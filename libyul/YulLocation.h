@@ -0,0 +1,113 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+/**
+ * Source location abstraction for Yul AST nodes that avoids copies.
+ */
+
+#pragma once
+
+#include <libyul/YulString.h>
+
+#include <liblangutil/SourceLocation.h>
+
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+namespace yul
+{
+
+/// Repository for the sources referred to by YulLocations, which refer to them by index.
+/// It keeps the sources alive until it is cleared together with the YulString repository,
+/// since the ASTs referring to them can be copied freely. Index zero stands for no source.
+class YulSourceRepository
+{
+public:
+	static YulSourceRepository& instance()
+	{
+		static YulSourceRepository inst;
+		static YulStringRepository::ResetCallback resetCallback{[]() { inst = YulSourceRepository{}; }};
+		return inst;
+	}
+
+	size_t sourceToIndex(std::shared_ptr<langutil::CharStream> const& _source)
+	{
+		if (!_source)
+			return 0;
+		auto it = m_indices.find(_source.get());
+		if (it != m_indices.end())
+			return it->second;
+		m_sources.emplace_back(_source);
+		return m_indices[_source.get()] = m_sources.size() - 1;
+	}
+	std::shared_ptr<langutil::CharStream> const& indexToSource(size_t _index) const { return m_sources.at(_index); }
+
+private:
+	YulSourceRepository() = default;
+	YulSourceRepository(YulSourceRepository const&) = delete;
+	YulSourceRepository(YulSourceRepository&&) = default;
+	YulSourceRepository& operator=(YulSourceRepository const&) = delete;
+	YulSourceRepository& operator=(YulSourceRepository&&) = default;
+
+	std::vector<std::shared_ptr<langutil::CharStream>> m_sources = {{}};
+	std::unordered_map<langutil::CharStream const*, size_t> m_indices;
+};
+
+/// Source location of Yul AST nodes. Stores the offsets and the index of the source
+/// in the YulSourceRepository, so that copying and comparing it does not touch the
+/// source it refers to. Converts implicitly from and to langutil::SourceLocation.
+class YulLocation
+{
+public:
+	YulLocation() = default;
+	YulLocation(langutil::SourceLocation const& _location):
+		m_start(_location.start),
+		m_end(_location.end),
+		m_sourceIndex(YulSourceRepository::instance().sourceToIndex(_location.source))
+	{}
+
+	operator langutil::SourceLocation() const { return get(); }
+	langutil::SourceLocation get() const
+	{
+		return {m_start, m_end, YulSourceRepository::instance().indexToSource(m_sourceIndex)};
+	}
+
+	int start() const { return m_start; }
+	int end() const { return m_end; }
+	bool isEmpty() const { return m_start == -1 && m_end == -1; }
+
+	/// @returns a copy of this location that ends at @a _end.
+	YulLocation withEnd(int _end) const
+	{
+		YulLocation location = *this;
+		location.m_end = _end;
+		return location;
+	}
+
+	bool operator==(YulLocation const& _other) const
+	{
+		return m_start == _other.m_start && m_end == _other.m_end && m_sourceIndex == _other.m_sourceIndex;
+	}
+	bool operator!=(YulLocation const& _other) const { return !operator==(_other); }
+
+private:
+	int m_start = -1;
+	int m_end = -1;
+	size_t m_sourceIndex = 0;
+};
+
+}
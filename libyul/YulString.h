@@ -65,6 +65,17 @@ public:
 
 		return Handle{id, h};
 	}
+	/// @returns true if @a _string is stored in the repository, without storing it otherwise.
+	bool contains(std::string const& _string) const
+	{
+		if (_string.empty())
+			return true;
+		auto range = m_hashToID.equal_range(hash(_string));
+		for (auto it = range.first; it != range.second; ++it)
+			if (*m_strings[it->second] == _string)
+				return true;
+		return false;
+	}
 	std::string const& idToString(size_t _id) const	{ return *m_strings.at(_id); }
 
 	static std::uint64_t hash(std::string const& v)
@@ -33,6 +33,52 @@ using namespace std;
 using namespace dev;
 using namespace yul;
 
+namespace
+{
+
+/// @returns the identifier whose value is the first one pushed when generating code for
+/// @a _expression, or nullptr if something else is pushed first.
+Identifier const* firstPushedIdentifier(Expression const& _expression, EVMDialect const& _dialect, bool _evm15)
+{
+	if (Identifier const* identifier = boost::get<Identifier>(&_expression))
+		return identifier;
+	else if (FunctionCall const* call = boost::get<FunctionCall>(&_expression))
+	{
+		// Calls to user-defined functions push the return label first on EVM 1.0.
+		if (call->arguments.empty() || (!_evm15 && !_dialect.builtin(call->functionName.name)))
+			return nullptr;
+		return firstPushedIdentifier(call->arguments.back(), _dialect, _evm15);
+	}
+	else if (FunctionalInstruction const* instruction = boost::get<FunctionalInstruction>(&_expression))
+	{
+		if (instruction->arguments.empty() || (_evm15 && (
+			instruction->instruction == dev::eth::Instruction::JUMP ||
+			instruction->instruction == dev::eth::Instruction::JUMPI
+		)))
+			return nullptr;
+		return firstPushedIdentifier(instruction->arguments.back(), _dialect, _evm15);
+	}
+	return nullptr;
+}
+
+Identifier const* firstPushedIdentifier(Statement const& _statement, EVMDialect const& _dialect, bool _evm15)
+{
+	Expression const* expression = nullptr;
+	if (ExpressionStatement const* statement = boost::get<ExpressionStatement>(&_statement))
+		expression = &statement->expression;
+	else if (VariableDeclaration const* varDecl = boost::get<VariableDeclaration>(&_statement))
+		expression = varDecl->value.get();
+	else if (Assignment const* assignment = boost::get<Assignment>(&_statement))
+		expression = assignment->value.get();
+	else if (If const* _if = boost::get<If>(&_statement))
+		expression = _if->condition.get();
+	else if (Switch const* _switch = boost::get<Switch>(&_statement))
+		expression = _switch->expression.get();
+	return expression ? firstPushedIdentifier(*expression, _dialect, _evm15) : nullptr;
+}
+
+}
+
 void VariableReferenceCounter::operator()(Identifier const& _identifier)
 {
 	increaseRefIfFound(_identifier.name);
@@ -171,6 +217,36 @@ void CodeTransform::deleteVariable(Scope::Variable const& _var)
 	m_variablesScheduledForDeletion.erase(&_var);
 }
 
+void CodeTransform::takeOverTopmostVariable(Statement const& _statement)
+{
+	solAssert(m_allowStackOpt, "");
+	Identifier const* identifier = firstPushedIdentifier(_statement, m_dialect, m_evm15);
+	// Only variables of the current scope are freed at statement level.
+	if (!identifier || !m_scope->identifiers.count(identifier->name))
+		return;
+	Scope::Variable const* var = boost::get<Scope::Variable>(&m_scope->identifiers.at(identifier->name));
+	if (
+		!var ||
+		!m_context->variableReferences.count(var) ||
+		m_context->variableReferences.at(var) != 1 ||
+		!m_context->variableStackHeights.count(var) ||
+		m_context->variableStackHeights.at(var) != m_assembly.stackHeight() - 1
+	)
+		return;
+	// The body of an if statement is visited after its condition is consumed and
+	// would pop an unused slot that ends up on top of the stack.
+	if (_statement.type() == typeid(If) && m_unusedStackSlots.count(m_assembly.stackHeight() - 2))
+		return;
+
+	// The slot now counts as pushed by the statement, which finds the value
+	// already in place when it visits the identifier.
+	m_context->variableStackHeights.erase(var);
+	m_context->variableReferences.erase(var);
+	m_assembly.setStackHeight(m_assembly.stackHeight() - 1);
+	--m_stackAdjustment;
+	m_takenOverVariable = var;
+}
+
 void CodeTransform::operator()(VariableDeclaration const& _varDecl)
 {
 	solAssert(m_scope, "");
@@ -364,8 +440,12 @@ void CodeTransform::operator()(Identifier const& _identifier)
 	if (m_scope->lookup(_identifier.name, Scope::NonconstVisitor(
 		[=](Scope::Variable& _var)
 		{
-			// TODO: opportunity for optimization: Do not DUP if this is the last reference
-			// to the top most element of the stack
+			if (&_var == m_takenOverVariable)
+			{
+				m_assembly.setStackHeight(m_assembly.stackHeight() + 1);
+				m_takenOverVariable = nullptr;
+				return;
+			}
 			if (int heightDiff = variableHeightDiff(_var, _identifier.name, false))
 				m_assembly.appendInstruction(dev::eth::dupInstruction(heightDiff));
 			else
@@ -743,7 +823,10 @@ void CodeTransform::visitStatements(vector<Statement> const& _statements)
 			jumpTarget = boost::none;
 		}
 
+		if (m_allowStackOpt)
+			takeOverTopmostVariable(statement);
 		boost::apply_visitor(*this, statement);
+		solAssert(!m_takenOverVariable, "");
 	}
 	// we may have a leftover jumpTarget
 	if (jumpTarget)
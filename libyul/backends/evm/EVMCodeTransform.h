@@ -169,6 +169,10 @@ protected:
 	void freeUnusedVariables();
 	/// Marks the stack slot of @a _var to be reused.
 	void deleteVariable(Scope::Variable const& _var);
+	/// If the first value @a _statement pushes is the last reference to the variable
+	/// on top of the stack, lets the statement take over the stack slot of the variable
+	/// instead of duplicating it and popping the variable afterwards.
+	void takeOverTopmostVariable(Statement const& _statement);
 
 public:
 	void operator()(Instruction const& _instruction);
@@ -245,6 +249,8 @@ private:
 	/// statement level in the scope where the variable was defined.
 	std::set<Scope::Variable const*> m_variablesScheduledForDeletion;
 	std::set<int> m_unusedStackSlots;
+	/// Variable whose stack slot is taken over by the current statement, see takeOverTopmostVariable.
+	Scope::Variable const* m_takenOverVariable = nullptr;
 
 	std::vector<StackTooDeepError> m_stackErrors;
 };
@@ -40,9 +40,10 @@ size_t GasMeter::costs(Expression const& _expression) const
 	return combineCosts(GasMeterVisitor::costs(_expression, m_dialect, m_isCreation));
 }
 
-size_t GasMeter::instructionCosts(eth::Instruction _instruction) const
+size_t GasMeter::instructionCosts(eth::Instruction _instruction, size_t _executions) const
 {
-	return combineCosts(GasMeterVisitor::instructionCosts(_instruction, m_dialect, m_isCreation));
+	pair<size_t, size_t> costs = GasMeterVisitor::instructionCosts(_instruction, m_dialect, m_isCreation);
+	return combineCosts({costs.first * _executions, costs.second});
 }
 
 size_t GasMeter::combineCosts(std::pair<size_t, size_t> _costs) const
@@ -49,7 +49,8 @@ public:
 	size_t costs(Expression const& _expression) const;
 	/// @returns the combined costs of deploying and running the instruction, not including
 	/// the costs for its arguments.
-	size_t instructionCosts(dev::eth::Instruction _instruction) const;
+	/// @param _executions the number of times the instruction is executed in each run.
+	size_t instructionCosts(dev::eth::Instruction _instruction, size_t _executions = 1) const;
 
 private:
 	size_t combineCosts(std::pair<size_t, size_t> _costs) const;
@@ -31,6 +31,11 @@ using namespace std;
 using namespace dev;
 using namespace yul;
 
+void CommonSubexpressionEliminator::run(Dialect const& _dialect, Block& _ast)
+{
+	CommonSubexpressionEliminator{_dialect, SideEffectsPropagator::sideEffects(_dialect, _ast)}(_ast);
+}
+
 void CommonSubexpressionEliminator::visit(Expression& _e)
 {
 	bool descend = true;
@@ -37,7 +37,13 @@ struct Dialect;
 class CommonSubexpressionEliminator: public DataFlowAnalyzer
 {
 public:
-	CommonSubexpressionEliminator(Dialect const& _dialect): DataFlowAnalyzer(_dialect) {}
+	/// Runs the step on @a _ast, taking the side effects of its functions into account.
+	static void run(Dialect const& _dialect, Block& _ast);
+
+	CommonSubexpressionEliminator(
+		Dialect const& _dialect,
+		std::map<YulString, SideEffects> _functionSideEffects = {}
+	): DataFlowAnalyzer(_dialect, std::move(_functionSideEffects)) {}
 
 protected:
 	using ASTModifier::visit;
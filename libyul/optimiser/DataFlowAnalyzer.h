@@ -24,6 +24,7 @@
 
 #include <libyul/optimiser/ASTWalker.h>
 #include <libyul/optimiser/KnowledgeBase.h>
+#include <libyul/optimiser/Semantics.h>
 #include <libyul/YulString.h>
 #include <libyul/AsmData.h>
 
@@ -62,13 +63,22 @@ struct Dialect;
  * older version of the other and thus overlapping contents would have been deleted already
  * at the point of assignment.
  *
+ * Calls to user-defined functions are considered movable or to keep storage and memory
+ * intact if this follows from the side effects provided for them (see SideEffectsPropagator).
+ *
  * Prerequisite: Disambiguator, ForLoopInitRewriter.
  */
 class DataFlowAnalyzer: public ASTModifier
 {
 public:
-	explicit DataFlowAnalyzer(Dialect const& _dialect):
+	/// @param _functionSideEffects side effects of the user-defined functions,
+	/// calls to other functions are assumed to have all side effects.
+	explicit DataFlowAnalyzer(
+		Dialect const& _dialect,
+		std::map<YulString, SideEffects> _functionSideEffects = {}
+	):
 		m_dialect(_dialect),
+		m_functionSideEffects(std::move(_functionSideEffects)),
 		m_knowledgeBase(_dialect, m_value)
 	{}
 
@@ -102,17 +112,14 @@ protected:
 	/// Clears knowledge about storage or memory if they may be modified inside the expression.
 	void clearKnowledgeIfInvalidated(Expression const& _expression);
 
-	/// Joins knowledge about storage and memory with an older point in the control-flow.
-	/// This only works if the current state is a direct successor of the older point,
-	/// i.e. `_otherStorage` and `_otherMemory` cannot have additional changes.
-	void joinKnowledge(
-		InvertibleMap<YulString, YulString> const& _olderStorage,
-		InvertibleMap<YulString, YulString> const& _olderMemory
-	);
+	/// Joins knowledge about storage and memory with an older point in the control-flow,
+	/// given by checkpoints of m_storage and m_memory, and releases the checkpoints.
+	/// Since the checkpoints only record changes, entering a branch does not copy the knowledge.
+	void joinKnowledge(size_t _storageCheckpoint, size_t _memoryCheckpoint);
 
 	static void joinKnowledgeHelper(
 		InvertibleMap<YulString, YulString>& _thisData,
-		InvertibleMap<YulString, YulString> const& _olderData
+		size_t _checkpoint
 	);
 
 	/// Returns true iff the variable is in scope.
@@ -124,6 +131,8 @@ protected:
 	) const;
 
 	Dialect const& m_dialect;
+	/// Side effects of the user-defined functions.
+	std::map<YulString, SideEffects> m_functionSideEffects;
 
 	/// Current values of variables, always movable.
 	std::map<YulString, Expression const*> m_value;
@@ -32,6 +32,11 @@ using namespace dev;
 using namespace yul;
 
 
+void DeadCodeEliminator::run(Dialect const& _dialect, Block& _ast)
+{
+	DeadCodeEliminator{_dialect, TerminationFinder::terminatingFunctions(_dialect, _ast)}(_ast);
+}
+
 void DeadCodeEliminator::operator()(ForLoop& _for)
 {
 	yulAssert(_for.pre.statements.empty(), "DeadCodeEliminator needs ForLoopInitRewriter as a prerequisite.");
@@ -42,7 +47,7 @@ void DeadCodeEliminator::operator()(Block& _block)
 {
 	TerminationFinder::ControlFlow controlFlowChange;
 	size_t index;
-	tie(controlFlowChange, index) = TerminationFinder{m_dialect}.firstUnconditionalControlFlowChange(_block.statements);
+	tie(controlFlowChange, index) = TerminationFinder{m_dialect, &m_terminatingFunctions}.firstUnconditionalControlFlowChange(_block.statements);
 
 	// Erase everything after the terminating statement that is not a function definition.
 	if (controlFlowChange != TerminationFinder::ControlFlow::FlowOut && index != size_t(-1))
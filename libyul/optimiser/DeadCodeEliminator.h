@@ -34,7 +34,8 @@ struct Dialect;
  * Optimisation stage that removes unreachable code
  *
  * Unreachable code is any code within a block which is preceded by a
- * return, invalid, break, continue, selfdestruct or revert.
+ * return, invalid, break, continue, selfdestruct or revert or by a call
+ * to a user-defined function that always terminates (see run()).
  *
  * Function definitions are retained as they might be called by earlier
  * code and thus are considered reachable.
@@ -47,7 +48,14 @@ struct Dialect;
 class DeadCodeEliminator: public ASTModifier
 {
 public:
-	DeadCodeEliminator(Dialect const& _dialect): m_dialect(_dialect) {}
+	/// Runs the step on @a _ast, also treating calls to functions that always
+	/// terminate as terminating.
+	static void run(Dialect const& _dialect, Block& _ast);
+
+	DeadCodeEliminator(Dialect const& _dialect, std::set<YulString> _terminatingFunctions = {}):
+		m_dialect(_dialect),
+		m_terminatingFunctions(std::move(_terminatingFunctions))
+	{}
 
 	using ASTModifier::operator();
 	void operator()(ForLoop& _for) override;
@@ -55,6 +63,8 @@ public:
 
 private:
 	Dialect const& m_dialect;
+	/// User-defined functions that never return.
+	std::set<YulString> m_terminatingFunctions;
 };
 
 }
@@ -20,6 +20,8 @@
 
 #include <libyul/optimiser/Disambiguator.h>
 
+#include <libyul/optimiser/ASTWalker.h>
+
 #include <libyul/Exceptions.h>
 #include <libyul/AsmData.h>
 #include <libyul/AsmScope.h>
@@ -29,6 +31,77 @@ using namespace std;
 using namespace dev;
 using namespace yul;
 
+/**
+ * Walks the AST in the same order as the ASTCopier and renames the
+ * identifiers using the translation of the Disambiguator.
+ */
+class Disambiguator::InPlaceRenamer: public ASTModifier
+{
+public:
+	explicit InPlaceRenamer(Disambiguator& _disambiguator): m_disambiguator(_disambiguator) {}
+
+	using ASTModifier::operator();
+	void operator()(Identifier& _identifier) override
+	{
+		_identifier.name = m_disambiguator.translateIdentifier(_identifier.name);
+	}
+	void operator()(FunctionalInstruction& _instruction) override
+	{
+		walkVector(_instruction.arguments);
+	}
+	void operator()(FunctionCall& _funCall) override
+	{
+		(*this)(_funCall.functionName);
+		walkVector(_funCall.arguments);
+	}
+	void operator()(VariableDeclaration& _varDecl) override
+	{
+		rename(_varDecl.variables);
+		ASTModifier::operator()(_varDecl);
+	}
+	void operator()(FunctionDefinition& _function) override
+	{
+		_function.name = m_disambiguator.translateIdentifier(_function.name);
+		m_disambiguator.enterFunction(_function);
+		rename(_function.parameters);
+		rename(_function.returnVariables);
+		(*this)(_function.body);
+		m_disambiguator.leaveFunction(_function);
+	}
+	void operator()(ForLoop& _forLoop) override
+	{
+		m_disambiguator.enterScope(_forLoop.pre);
+		ASTModifier::operator()(_forLoop);
+		m_disambiguator.leaveScope(_forLoop.pre);
+	}
+	void operator()(Block& _block) override
+	{
+		m_disambiguator.enterScope(_block);
+		ASTModifier::operator()(_block);
+		m_disambiguator.leaveScope(_block);
+	}
+
+private:
+	void rename(TypedNameList& _names)
+	{
+		for (auto& name: _names)
+			name.name = m_disambiguator.translateIdentifier(name.name);
+	}
+
+	Disambiguator& m_disambiguator;
+};
+
+void Disambiguator::run(
+	Dialect const& _dialect,
+	Block& _ast,
+	AsmAnalysisInfo const& _analysisInfo,
+	set<YulString> const& _externallyUsedIdentifiers
+)
+{
+	Disambiguator disambiguator{_dialect, _analysisInfo, _externallyUsedIdentifiers};
+	InPlaceRenamer{disambiguator}(_ast);
+}
+
 YulString Disambiguator::translateIdentifier(YulString _originalName)
 {
 	if (m_dialect.builtin(_originalName) || m_externallyUsedIdentifiers.count(_originalName))
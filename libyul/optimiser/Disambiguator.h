@@ -36,6 +36,9 @@ struct Dialect;
 
 /**
  * Creates a copy of a Yul AST replacing all identifiers by unique names.
+ *
+ * Use Disambiguator::run to replace the identifiers in place instead, which
+ * avoids holding two copies of the AST at the same time.
  */
 class Disambiguator: public ASTCopier
 {
@@ -52,7 +55,20 @@ public:
 	{
 	}
 
+	/// Replaces all identifiers in @a _ast by unique names without copying it.
+	/// The names are the same as in the copy created by the Disambiguator.
+	/// @param _analysisInfo the analysis information of @a _ast, which is not
+	/// valid for the modified AST anymore.
+	static void run(
+		Dialect const& _dialect,
+		Block& _ast,
+		AsmAnalysisInfo const& _analysisInfo,
+		std::set<YulString> const& _externallyUsedIdentifiers = {}
+	);
+
 protected:
+	class InPlaceRenamer;
+
 	void enterScope(Block const& _block) override;
 	void leaveScope(Block const& _block) override;
 	void enterFunction(FunctionDefinition const& _function) override;
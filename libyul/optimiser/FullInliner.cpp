@@ -26,20 +26,23 @@
 #include <libyul/optimiser/OptimizerUtilities.h>
 #include <libyul/optimiser/Metrics.h>
 #include <libyul/optimiser/SSAValueTracker.h>
+#include <libyul/backends/evm/EVMMetrics.h>
 #include <libyul/Exceptions.h>
 #include <libyul/AsmData.h>
 
 #include <libdevcore/CommonData.h>
 #include <libdevcore/Visitor.h>
 
+#include <libevmasm/Instruction.h>
+
 #include <boost/range/adaptor/reversed.hpp>
 
 using namespace std;
 using namespace dev;
 using namespace yul;
 
-FullInliner::FullInliner(Block& _ast, NameDispenser& _dispenser):
-	m_ast(_ast), m_nameDispenser(_dispenser)
+FullInliner::FullInliner(Block& _ast, NameDispenser& _dispenser, GasMeter const* _meter):
+	m_ast(_ast), m_nameDispenser(_dispenser), m_meter(_meter)
 {
 	// Determine constants
 	SSAValueTracker tracker;
@@ -79,7 +82,7 @@ void FullInliner::run()
 	}
 }
 
-bool FullInliner::shallInline(FunctionCall const& _funCall, YulString _callSite)
+bool FullInliner::shallInline(FunctionCall const& _funCall, YulString _callSite, size_t _loopDepth)
 {
 	// No recursive inlining
 	if (_funCall.functionName.name == _callSite)
@@ -116,7 +119,15 @@ bool FullInliner::shallInline(FunctionCall const& _funCall, YulString _callSite)
 			break;
 		}
 
-	return (size < 6 || (constantArg && size < 12));
+	if (size < 6 || (constantArg && size < 12))
+		return true;
+
+	// Calls inside loops are executed more often, so larger functions can be
+	// worth inlining there, as long as the call site does not get too big.
+	if (m_meter && _loopDepth > 0 && m_functionSizes.at(_callSite) + size <= 45)
+		return profitableInLoop(*calledFunction, size, _loopDepth);
+
+	return false;
 }
 
 void FullInliner::tentativelyUpdateCodeSize(YulString _function, YulString _callSite)
@@ -140,6 +151,41 @@ bool FullInliner::recursive(FunctionDefinition const& _fun) const
 	return references[_fun.name] > 0;
 }
 
+bool FullInliner::profitableInLoop(FunctionDefinition const& _function, size_t _size, size_t _loopDepth) const
+{
+	yulAssert(m_meter, "");
+
+	// We do not know the number of iterations, so we assume that
+	// every loop runs ten times and only consider the innermost three loops.
+	size_t executions = 1;
+	for (size_t i = 0; i < min<size_t>(_loopDepth, 3); ++i)
+		executions *= 10;
+
+	// A call pushes the return label, jumps to the function and back and
+	// has to rearrange the arguments and return values on the stack.
+	size_t callCosts =
+		m_meter->instructionCosts(eth::Instruction::PUSH1, executions) +
+		2 * m_meter->instructionCosts(eth::Instruction::JUMP, executions) +
+		2 * m_meter->instructionCosts(eth::Instruction::JUMPDEST, executions) +
+		(_function.parameters.size() + _function.returnVariables.size()) *
+		m_meter->instructionCosts(eth::Instruction::SWAP1, executions);
+	// Inlining replaces the call by a copy of the body, which is
+	// assumed to need roughly one byte of code per unit of code size.
+	size_t codeCosts = _size * m_meter->instructionCosts(eth::Instruction::DUP1, 0);
+
+	return callCosts > codeCosts;
+}
+
+void InlineModifier::operator()(ForLoop& _loop)
+{
+	(*this)(_loop.pre);
+	visit(*_loop.condition);
+	++m_loopDepth;
+	(*this)(_loop.post);
+	(*this)(_loop.body);
+	--m_loopDepth;
+}
+
 void InlineModifier::operator()(Block& _block)
 {
 	function<boost::optional<vector<Statement>>(Statement&)> f = [&](Statement& _statement) -> boost::optional<vector<Statement>> {
@@ -163,7 +209,7 @@ boost::optional<vector<Statement>> InlineModifier::tryInlineStatement(Statement&
 		FunctionCall* funCall = boost::apply_visitor(GenericFallbackReturnsVisitor<FunctionCall*, FunctionCall&>(
 			[](FunctionCall& _e) { return &_e; }
 		), *e);
-		if (funCall && m_driver.shallInline(*funCall, m_currentFunction))
+		if (funCall && m_driver.shallInline(*funCall, m_currentFunction, m_loopDepth))
 			return performInline(_statement, *funCall);
 	}
 	return {};
@@ -37,6 +37,7 @@ namespace yul
 {
 
 class NameCollector;
+class GasMeter;
 
 
 /**
@@ -63,19 +64,24 @@ class NameCollector;
  * code of f, with replacements: a -> f_a, b -> f_b, c -> f_c
  * let z := f_c
  *
+ * If a gas meter is provided, calls inside for loops are also inlined if the gas
+ * saved by avoiding the call in every iteration outweighs the costs of deploying
+ * the additional code, as estimated by the gas meter.
+ *
  * Prerequisites: Disambiguator
  * More efficient if run after: Function Hoister, Expression Splitter
  */
 class FullInliner: public ASTModifier
 {
 public:
-	explicit FullInliner(Block& _ast, NameDispenser& _dispenser);
+	explicit FullInliner(Block& _ast, NameDispenser& _dispenser, GasMeter const* _meter = nullptr);
 
 	void run();
 
 	/// Inlining heuristic.
 	/// @param _callSite the name of the function in which the function call is located.
-	bool shallInline(FunctionCall const& _funCall, YulString _callSite);
+	/// @param _loopDepth the number of for loop bodies the function call is located in.
+	bool shallInline(FunctionCall const& _funCall, YulString _callSite, size_t _loopDepth = 0);
 
 	FunctionDefinition* function(YulString _name)
 	{
@@ -94,6 +100,9 @@ private:
 	void updateCodeSize(FunctionDefinition const& _fun);
 	void handleBlock(YulString _currentFunctionName, Block& _block);
 	bool recursive(FunctionDefinition const& _fun) const;
+	/// @returns true if the runtime gas saved by inlining a call to @a _function that
+	/// is located in @a _loopDepth nested loops outweighs the costs of the larger code.
+	bool profitableInLoop(FunctionDefinition const& _function, size_t _size, size_t _loopDepth) const;
 
 	/// The AST to be modified. The root block itself will not be modified, because
 	/// we store pointers to functions.
@@ -105,6 +114,7 @@ private:
 	std::set<YulString> m_constants;
 	std::map<YulString, size_t> m_functionSizes;
 	NameDispenser& m_nameDispenser;
+	GasMeter const* m_meter = nullptr;
 };
 
 /**
@@ -120,6 +130,7 @@ public:
 		m_nameDispenser(_nameDispenser)
 	{ }
 
+	void operator()(ForLoop& _loop) override;
 	void operator()(Block& _block) override;
 
 private:
@@ -127,6 +138,8 @@ private:
 	std::vector<Statement> performInline(Statement& _statement, FunctionCall& _funCall);
 
 	YulString m_currentFunction;
+	/// Number of for loop bodies (including post blocks) the current statement is located in.
+	size_t m_loopDepth = 0;
 	FullInliner& m_driver;
 	NameDispenser& m_nameDispenser;
 };
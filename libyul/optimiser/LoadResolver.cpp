@@ -32,7 +32,7 @@ using namespace yul;
 void LoadResolver::run(Dialect const& _dialect, Block& _ast)
 {
 	bool containsMSize = SideEffectsCollector(_dialect, _ast).containsMSize();
-	LoadResolver{_dialect, !containsMSize}(_ast);
+	LoadResolver{_dialect, SideEffectsPropagator::sideEffects(_dialect, _ast), !containsMSize}(_ast);
 }
 
 void LoadResolver::visit(Expression& _e)
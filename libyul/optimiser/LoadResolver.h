@@ -42,8 +42,12 @@ public:
 	static void run(Dialect const& _dialect, Block& _ast);
 
 private:
-	LoadResolver(Dialect const& _dialect, bool _optimizeMLoad):
-		DataFlowAnalyzer(_dialect),
+	LoadResolver(
+		Dialect const& _dialect,
+		std::map<YulString, SideEffects> _functionSideEffects,
+		bool _optimizeMLoad
+	):
+		DataFlowAnalyzer(_dialect, std::move(_functionSideEffects)),
 		m_optimizeMLoad(_optimizeMLoad)
 	{}
 
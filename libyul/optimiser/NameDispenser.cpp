@@ -45,21 +45,40 @@ NameDispenser::NameDispenser(Dialect const& _dialect, set<YulString> _usedNames)
 
 YulString NameDispenser::newName(YulString _nameHint)
 {
-	YulString name = _nameHint;
-	while (illegalName(name))
+	if (!illegalName(_nameHint.str()))
+	{
+		m_usedNames.emplace(_nameHint);
+		return _nameHint;
+	}
+
+	string const hint = _nameHint.str() + "_";
+	string name;
+	do
 	{
 		m_counter++;
-		name = YulString(_nameHint.str() + "_" + to_string(m_counter));
+		name = hint + to_string(m_counter);
 	}
-	m_usedNames.emplace(name);
-	return name;
+	while (illegalName(name));
+
+	YulString newName{name};
+	m_usedNames.emplace(newName);
+	return newName;
 }
 
-bool NameDispenser::illegalName(YulString _name)
+bool NameDispenser::illegalName(string const& _name) const
 {
-	if (_name.empty() || m_usedNames.count(_name) || m_dialect.builtin(_name))
+	if (_name.empty())
 		return true;
+	// A name that has never been stored in the string repository can neither be
+	// used nor be a builtin. Checking this first avoids storing all the rejected
+	// candidates of newName.
+	if (YulStringRepository::instance().contains(_name))
+	{
+		YulString name{_name};
+		if (m_usedNames.count(name) || m_dialect.builtin(name))
+			return true;
+	}
 	if (dynamic_cast<EVMDialect const*>(&m_dialect))
-		return Parser::instructions().count(_name.str());
+		return Parser::instructions().count(_name);
 	return false;
 }
@@ -24,6 +24,7 @@
 #include <libyul/YulString.h>
 
 #include <set>
+#include <string>
 
 namespace yul
 {
@@ -51,7 +52,7 @@ public:
 	void markUsed(YulString _name) { m_usedNames.insert(_name); }
 
 private:
-	bool illegalName(YulString _name);
+	bool illegalName(std::string const& _name) const;
 
 	Dialect const& m_dialect;
 	std::set<YulString> m_usedNames;
@@ -32,6 +32,29 @@ using namespace std;
 using namespace dev;
 using namespace yul;
 
+namespace
+{
+
+/**
+ * Collects the assignments to single variables, not including those in nested functions.
+ */
+class SingleAssignmentCollector: public ASTWalker
+{
+public:
+	using ASTWalker::operator();
+	void operator()(Assignment const& _assignment) override
+	{
+		ASTWalker::operator()(_assignment);
+		if (_assignment.variableNames.size() == 1)
+			assignments.push_back(&_assignment);
+	}
+	void operator()(FunctionDefinition const&) override {}
+
+	vector<Assignment const*> assignments;
+};
+
+}
+
 void RedundantAssignEliminator::operator()(Identifier const& _identifier)
 {
 	changeUndecidedTo(_identifier.name, State::Used);
@@ -52,8 +75,15 @@ void RedundantAssignEliminator::operator()(Assignment const& _assignment)
 		changeUndecidedTo(var.name, State::Unused);
 
 	if (_assignment.variableNames.size() == 1)
-		// Default-construct it in "Undecided" state if it does not yet exist.
-		m_assignments[_assignment.variableNames.front().name][&_assignment];
+	{
+		// Add it in "Undecided" state if it was not yet visited.
+		size_t index = m_assignmentNumbers.at(&_assignment);
+		if (!m_assignments.visited[index])
+		{
+			m_assignments.visited[index] = true;
+			m_assignments.undecided[index] = true;
+		}
+	}
 }
 
 void RedundantAssignEliminator::operator()(If const& _if)
@@ -97,10 +127,19 @@ void RedundantAssignEliminator::operator()(FunctionDefinition const& _functionDe
 	std::set<YulString> outerDeclaredVariables;
 	TrackedAssignments outerAssignments;
 	ForLoopInfo forLoopInfo;
+	vector<Assignment const*> outerNumberedAssignments;
+	unordered_map<Assignment const*, size_t> outerAssignmentNumbers;
+	map<YulString, vector<size_t>> outerAssignmentsOfVariable;
+	vector<uint8_t> outerMovableValues;
 	swap(m_declaredVariables, outerDeclaredVariables);
 	swap(m_assignments, outerAssignments);
 	swap(m_forLoopInfo, forLoopInfo);
+	swap(m_numberedAssignments, outerNumberedAssignments);
+	swap(m_assignmentNumbers, outerAssignmentNumbers);
+	swap(m_assignmentsOfVariable, outerAssignmentsOfVariable);
+	swap(m_movableValues, outerMovableValues);
 
+	numberAssignments(_functionDefinition.body);
 	(*this)(_functionDefinition.body);
 
 	for (auto const& param: _functionDefinition.parameters)
@@ -111,6 +150,10 @@ void RedundantAssignEliminator::operator()(FunctionDefinition const& _functionDe
 	swap(m_declaredVariables, outerDeclaredVariables);
 	swap(m_assignments, outerAssignments);
 	swap(m_forLoopInfo, forLoopInfo);
+	swap(m_numberedAssignments, outerNumberedAssignments);
+	swap(m_assignmentNumbers, outerAssignmentNumbers);
+	swap(m_assignmentsOfVariable, outerAssignmentsOfVariable);
+	swap(m_movableValues, outerMovableValues);
 }
 
 void RedundantAssignEliminator::operator()(ForLoop const& _forLoop)
@@ -158,15 +201,9 @@ void RedundantAssignEliminator::operator()(ForLoop const& _forLoop)
 		// Change all assignments that were newly introduced in the for loop to "used".
 		// We do not have to do that with the "break" or "continue" paths, because
 		// they will be joined later anyway.
-		// TODO parallel traversal might be more efficient here.
-		for (auto& var: m_assignments)
-			for (auto& assignment: var.second)
-			{
-				auto zeroIt = zeroRuns.find(var.first);
-				if (zeroIt != zeroRuns.end() && zeroIt->second.count(assignment.first))
-					continue;
-				assignment.second = State::Value::Used;
-			}
+		boost::dynamic_bitset<> newAssignments = m_assignments.visited - zeroRuns.visited;
+		m_assignments.used |= newAssignments;
+		m_assignments.undecided -= newAssignments;
 	}
 
 	// Order of merging does not matter because "max" is commutative and associative.
@@ -182,13 +219,13 @@ void RedundantAssignEliminator::operator()(ForLoop const& _forLoop)
 void RedundantAssignEliminator::operator()(Break const&)
 {
 	m_forLoopInfo.pendingBreakStmts.emplace_back(move(m_assignments));
-	m_assignments.clear();
+	m_assignments = TrackedAssignments(m_numberedAssignments.size());
 }
 
 void RedundantAssignEliminator::operator()(Continue const&)
 {
 	m_forLoopInfo.pendingContinueStmts.emplace_back(move(m_assignments));
-	m_assignments.clear();
+	m_assignments = TrackedAssignments(m_numberedAssignments.size());
 }
 
 void RedundantAssignEliminator::operator()(Block const& _block)
@@ -207,48 +244,21 @@ void RedundantAssignEliminator::operator()(Block const& _block)
 void RedundantAssignEliminator::run(Dialect const& _dialect, Block& _ast)
 {
 	RedundantAssignEliminator rae{_dialect};
+	rae.numberAssignments(_ast);
 	rae(_ast);
 
 	AssignmentRemover remover{rae.m_pendingRemovals};
 	remover(_ast);
 }
 
-template <class K, class V, class F>
-void joinMap(std::map<K, V>& _a, std::map<K, V>&& _b, F _conflictSolver)
-{
-	// TODO Perhaps it is better to just create a sorted list
-	// and then use insert(begin, end)
-
-	auto ita = _a.begin();
-	auto aend = _a.end();
-	auto itb = _b.begin();
-	auto bend = _b.end();
-
-	for (; itb != bend; ++ita)
-	{
-		if (ita == aend)
-			ita = _a.insert(ita, std::move(*itb++));
-		else if (ita->first < itb->first)
-			continue;
-		else if (itb->first < ita->first)
-			ita = _a.insert(ita, std::move(*itb++));
-		else
-		{
-			_conflictSolver(ita->second, std::move(itb->second));
-			++itb;
-		}
-	}
-}
-
 void RedundantAssignEliminator::merge(TrackedAssignments& _target, TrackedAssignments&& _other)
 {
-	joinMap(_target, move(_other), [](
-		map<Assignment const*, State>& _assignmentHere,
-		map<Assignment const*, State>&& _assignmentThere
-	)
-	{
-		return joinMap(_assignmentHere, move(_assignmentThere), State::join);
-	});
+	// Not visited is the neutral element, otherwise the rules above amount to
+	// taking the maximum of "unused" < "undecided" < "used".
+	_target.visited |= _other.visited;
+	_target.used |= _other.used;
+	_target.undecided |= _other.undecided;
+	_target.undecided -= _target.used;
 }
 
 void RedundantAssignEliminator::merge(TrackedAssignments& _target, vector<TrackedAssignments>&& _source)
@@ -260,9 +270,16 @@ void RedundantAssignEliminator::merge(TrackedAssignments& _target, vector<Tracke
 
 void RedundantAssignEliminator::changeUndecidedTo(YulString _variable, RedundantAssignEliminator::State _newState)
 {
-	for (auto& assignment: m_assignments[_variable])
-		if (assignment.second == State::Undecided)
-			assignment.second = _newState;
+	auto it = m_assignmentsOfVariable.find(_variable);
+	if (it == m_assignmentsOfVariable.end())
+		return;
+	for (size_t index: it->second)
+		if (m_assignments.undecided[index])
+		{
+			m_assignments.undecided[index] = false;
+			if (_newState == State::Used)
+				m_assignments.used[index] = true;
+		}
 }
 
 void RedundantAssignEliminator::finalize(YulString _variable, RedundantAssignEliminator::State _finalState)
@@ -280,16 +297,52 @@ void RedundantAssignEliminator::finalize(
 	RedundantAssignEliminator::State _finalState
 )
 {
-	for (auto const& assignment: _assignments[_variable])
+	auto it = m_assignmentsOfVariable.find(_variable);
+	if (it == m_assignmentsOfVariable.end())
+		return;
+	for (size_t index: it->second)
 	{
-		State const state = assignment.second == State::Undecided ? _finalState : assignment.second;
+		if (!_assignments.visited[index])
+			continue;
+		State const state =
+			_assignments.undecided[index] ? _finalState :
+			_assignments.used[index] ? State::Used :
+			State::Unused;
 
-		if (state == State::Unused && SideEffectsCollector{*m_dialect, *assignment.first->value}.movable())
+		if (state == State::Unused && movableValue(index))
 			// TODO the only point where we actually need this
 			// to be a set is for the for loop
-			m_pendingRemovals.insert(assignment.first);
+			m_pendingRemovals.insert(m_numberedAssignments[index]);
+
+		_assignments.visited[index] = false;
+		_assignments.undecided[index] = false;
+		_assignments.used[index] = false;
+	}
+}
+
+bool RedundantAssignEliminator::movableValue(size_t _index)
+{
+	if (m_movableValues[_index] == 0)
+		m_movableValues[_index] =
+			SideEffectsCollector{*m_dialect, *m_numberedAssignments[_index]->value}.movable() ? 1 : 2;
+	return m_movableValues[_index] == 1;
+}
+
+void RedundantAssignEliminator::numberAssignments(Block const& _code)
+{
+	SingleAssignmentCollector collector;
+	collector(_code);
+
+	m_numberedAssignments = move(collector.assignments);
+	m_assignmentNumbers.clear();
+	m_assignmentsOfVariable.clear();
+	for (size_t i = 0; i < m_numberedAssignments.size(); ++i)
+	{
+		m_assignmentNumbers[m_numberedAssignments[i]] = i;
+		m_assignmentsOfVariable[m_numberedAssignments[i]->variableNames.front().name].push_back(i);
 	}
-	_assignments.erase(_variable);
+	m_movableValues.assign(m_numberedAssignments.size(), 0);
+	m_assignments = TrackedAssignments(m_numberedAssignments.size());
 }
 
 void AssignmentRemover::operator()(Block& _block)
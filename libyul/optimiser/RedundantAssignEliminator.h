@@ -24,7 +24,10 @@
 #include <libyul/AsmDataForward.h>
 #include <libyul/optimiser/ASTWalker.h>
 
+#include <boost/dynamic_bitset.hpp>
+
 #include <map>
+#include <unordered_map>
 #include <vector>
 
 namespace yul
@@ -96,6 +99,10 @@ struct Dialect;
  *
  * In the second traversal, all assignments that are in the "unused" state are removed.
  *
+ * The assignments of each function (and of the code outside of functions) are numbered
+ * before the function is traversed and the mapping is stored as bit vectors indexed by
+ * these numbers, so that joining control-flow paths is a word-wise operation.
+ *
  *
  * This step is usually run right after the SSA transform to complete
  * the generation of the pseudo-SSA.
@@ -133,18 +140,20 @@ private:
 		State(Value _value = Undecided): m_value(_value) {}
 		inline bool operator==(State _other) const { return m_value == _other.m_value; }
 		inline bool operator!=(State _other) const { return !operator==(_other); }
-		static inline void join(State& _a, State const& _b)
-		{
-			// Using "max" works here because of the order of the values in the enum.
-			_a.m_value =  Value(std::max(int(_a.m_value), int(_b.m_value)));
-		}
 	private:
 		Value m_value = Undecided;
 	};
 
-	// TODO check that this does not cause nondeterminism!
-	// This could also be a pseudo-map from state to assignment.
-	using TrackedAssignments = std::map<YulString, std::map<Assignment const*, State>>;
+	/// States of the assignments of the function currently being traversed,
+	/// indexed by their number. Assignments that were not yet visited on
+	/// the current control-flow path are not "visited".
+	struct TrackedAssignments
+	{
+		explicit TrackedAssignments(size_t _size = 0): visited(_size), undecided(_size), used(_size) {}
+		boost::dynamic_bitset<> visited;
+		boost::dynamic_bitset<> undecided;
+		boost::dynamic_bitset<> used;
+	};
 
 	/// Joins the assignment mapping of @a _source into @a _target according to the rules laid out
 	/// above.
@@ -158,10 +167,25 @@ private:
 	void finalize(YulString _variable, State _finalState);
 	/// Helper function for the above.
 	void finalize(TrackedAssignments& _assignments, YulString _variable, State _finalState);
+	/// @returns true if the value of the assignment with the given number is movable.
+	bool movableValue(size_t _index);
+
+	/// Numbers the assignments in @a _code (not including nested functions) and resets
+	/// the tracked states accordingly.
+	void numberAssignments(Block const& _code);
 
 	Dialect const* m_dialect;
 	std::set<YulString> m_declaredVariables;
 	std::set<Assignment const*> m_pendingRemovals;
+
+	/// Assignments of the current function, by number.
+	std::vector<Assignment const*> m_numberedAssignments;
+	std::unordered_map<Assignment const*, size_t> m_assignmentNumbers;
+	/// Numbers of the assignments to each variable of the current function.
+	std::map<YulString, std::vector<size_t>> m_assignmentsOfVariable;
+	/// Cache for movableValue, 0 means unknown, 1 movable and 2 not movable.
+	std::vector<uint8_t> m_movableValues;
+
 	TrackedAssignments m_assignments;
 
 	/// Working data for traversing for-loops.
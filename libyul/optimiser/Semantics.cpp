@@ -33,20 +33,96 @@ using namespace std;
 using namespace dev;
 using namespace yul;
 
-SideEffectsCollector::SideEffectsCollector(Dialect const& _dialect, Expression const& _expression):
-	SideEffectsCollector(_dialect)
+namespace
+{
+
+/**
+ * Collects all function definitions of an AST (including nested ones) by name.
+ */
+class FunctionDefinitionCollector: public ASTWalker
+{
+public:
+	using ASTWalker::operator();
+	void operator()(FunctionDefinition const& _function) override
+	{
+		m_functions[_function.name].push_back(&_function);
+		ASTWalker::operator()(_function);
+	}
+
+	/// @returns the functions of @a _ast that are defined exactly once.
+	static map<YulString, FunctionDefinition const*> uniqueFunctions(Block const& _ast)
+	{
+		FunctionDefinitionCollector collector;
+		collector(_ast);
+		map<YulString, FunctionDefinition const*> ret;
+		for (auto const& function: collector.m_functions)
+			if (function.second.size() == 1)
+				ret[function.first] = function.second.front();
+		return ret;
+	}
+
+private:
+	map<YulString, vector<FunctionDefinition const*>> m_functions;
+};
+
+/**
+ * Collects the user-defined functions called by a piece of code and whether it contains loops.
+ */
+class CallsAndLoopsCollector: public ASTWalker
+{
+public:
+	explicit CallsAndLoopsCollector(Dialect const& _dialect): m_dialect(_dialect) {}
+
+	using ASTWalker::operator();
+	void operator()(FunctionCall const& _functionCall) override
+	{
+		ASTWalker::operator()(_functionCall);
+		if (!m_dialect.builtin(_functionCall.functionName.name))
+			m_callees.insert(_functionCall.functionName.name);
+	}
+	void operator()(ForLoop const& _forLoop) override
+	{
+		m_containsLoop = true;
+		ASTWalker::operator()(_forLoop);
+	}
+
+	set<YulString> const& callees() const { return m_callees; }
+	bool containsLoop() const { return m_containsLoop; }
+
+private:
+	Dialect const& m_dialect;
+	set<YulString> m_callees;
+	bool m_containsLoop = false;
+};
+
+}
+
+SideEffectsCollector::SideEffectsCollector(
+	Dialect const& _dialect,
+	Expression const& _expression,
+	map<YulString, SideEffects> const* _functionSideEffects
+):
+	SideEffectsCollector(_dialect, _functionSideEffects)
 {
 	visit(_expression);
 }
 
-SideEffectsCollector::SideEffectsCollector(Dialect const& _dialect, Statement const& _statement):
-	SideEffectsCollector(_dialect)
+SideEffectsCollector::SideEffectsCollector(
+	Dialect const& _dialect,
+	Statement const& _statement,
+	map<YulString, SideEffects> const* _functionSideEffects
+):
+	SideEffectsCollector(_dialect, _functionSideEffects)
 {
 	visit(_statement);
 }
 
-SideEffectsCollector::SideEffectsCollector(Dialect const& _dialect, Block const& _ast):
-	SideEffectsCollector(_dialect)
+SideEffectsCollector::SideEffectsCollector(
+	Dialect const& _dialect,
+	Block const& _ast,
+	map<YulString, SideEffects> const* _functionSideEffects
+):
+	SideEffectsCollector(_dialect, _functionSideEffects)
 {
 	operator()(_ast);
 }
@@ -56,50 +132,129 @@ void SideEffectsCollector::operator()(FunctionalInstruction const& _instr)
 	ASTWalker::operator()(_instr);
 
 	if (!eth::SemanticInformation::movable(_instr.instruction))
-		m_movable = false;
+		m_sideEffects.movable = false;
 	if (!eth::SemanticInformation::sideEffectFree(_instr.instruction))
-		m_sideEffectFree = false;
+		m_sideEffects.sideEffectFree = false;
 	if (!eth::SemanticInformation::sideEffectFreeIfNoMSize(_instr.instruction))
-		m_sideEffectFreeIfNoMSize = false;
+		m_sideEffects.sideEffectFreeIfNoMSize = false;
 	if (_instr.instruction == eth::Instruction::MSIZE)
-		m_containsMSize = true;
+		m_sideEffects.containsMSize = true;
 	if (eth::SemanticInformation::invalidatesStorage(_instr.instruction))
-		m_invalidatesStorage = true;
+		m_sideEffects.invalidatesStorage = true;
 	if (eth::SemanticInformation::invalidatesMemory(_instr.instruction))
-		m_invalidatesMemory = true;
+		m_sideEffects.invalidatesMemory = true;
 }
 
 void SideEffectsCollector::operator()(FunctionCall const& _functionCall)
 {
 	ASTWalker::operator()(_functionCall);
 
-	if (BuiltinFunction const* f = m_dialect.builtin(_functionCall.functionName.name))
+	YulString functionName = _functionCall.functionName.name;
+	if (BuiltinFunction const* f = m_dialect.builtin(functionName))
 	{
 		if (!f->movable)
-			m_movable = false;
+			m_sideEffects.movable = false;
 		if (!f->sideEffectFree)
-			m_sideEffectFree = false;
+			m_sideEffects.sideEffectFree = false;
 		if (!f->sideEffectFreeIfNoMSize)
-			m_sideEffectFreeIfNoMSize = false;
+			m_sideEffects.sideEffectFreeIfNoMSize = false;
 		if (f->isMSize)
-			m_containsMSize = true;
+			m_sideEffects.containsMSize = true;
 		if (f->invalidatesStorage)
-			m_invalidatesStorage = true;
+			m_sideEffects.invalidatesStorage = true;
 		if (f->invalidatesMemory)
-			m_invalidatesMemory = true;
+			m_sideEffects.invalidatesMemory = true;
 	}
+	else if (m_functionSideEffects && m_functionSideEffects->count(functionName))
+		m_sideEffects += m_functionSideEffects->at(functionName);
 	else
+		m_sideEffects += SideEffects::worst();
+}
+
+map<YulString, SideEffects> SideEffectsPropagator::sideEffects(Dialect const& _dialect, Block const& _ast)
+{
+	map<YulString, FunctionDefinition const*> functions = FunctionDefinitionCollector::uniqueFunctions(_ast);
+
+	// Side effects of the bodies themselves, calls to other known functions are ignored here.
+	map<YulString, SideEffects> noSideEffects;
+	for (auto const& function: functions)
+		noSideEffects[function.first] = SideEffects{};
+
+	map<YulString, SideEffects> localSideEffects;
+	map<YulString, set<YulString>> callees;
+	set<YulString> containsLoop;
+	for (auto const& function: functions)
+	{
+		localSideEffects[function.first] =
+			SideEffectsCollector(_dialect, function.second->body, &noSideEffects).sideEffects();
+		CallsAndLoopsCollector collector(_dialect);
+		collector(function.second->body);
+		for (YulString callee: collector.callees())
+			if (functions.count(callee))
+				callees[function.first].insert(callee);
+		if (collector.containsLoop())
+			containsLoop.insert(function.first);
+	}
+
+	// Functions reachable from each function via calls, which includes the function
+	// itself if it is part of a cycle in the call graph.
+	map<YulString, set<YulString>> reachable;
+	for (auto const& function: functions)
+	{
+		set<YulString>& visited = reachable[function.first];
+		vector<YulString> toVisit(callees[function.first].begin(), callees[function.first].end());
+		while (!toVisit.empty())
+		{
+			YulString callee = toVisit.back();
+			toVisit.pop_back();
+			if (!visited.insert(callee).second)
+				continue;
+			for (YulString next: callees[callee])
+				toVisit.push_back(next);
+		}
+	}
+
+	// A function might not terminate if it contains a loop or is recursive.
+	auto mightNotTerminateLocally = [&](YulString _function) {
+		return containsLoop.count(_function) || reachable[_function].count(_function);
+	};
+
+	map<YulString, SideEffects> ret;
+	for (auto const& function: functions)
 	{
-		m_movable = false;
-		m_sideEffectFree = false;
-		m_sideEffectFreeIfNoMSize = false;
-		m_invalidatesStorage = true;
-		m_invalidatesMemory = true;
+		SideEffects sideEffects = localSideEffects.at(function.first);
+		bool mightNotTerminate = mightNotTerminateLocally(function.first);
+		for (YulString callee: reachable[function.first])
+		{
+			sideEffects += localSideEffects.at(callee);
+			if (mightNotTerminateLocally(callee))
+				mightNotTerminate = true;
+		}
+		if (mightNotTerminate)
+		{
+			sideEffects.movable = false;
+			sideEffects.sideEffectFree = false;
+			sideEffects.sideEffectFreeIfNoMSize = false;
+		}
+		ret[function.first] = sideEffects;
 	}
+	return ret;
 }
 
-MovableChecker::MovableChecker(Dialect const& _dialect, Expression const& _expression):
-	MovableChecker(_dialect)
+MovableChecker::MovableChecker(
+	Dialect const& _dialect,
+	map<YulString, SideEffects> const* _functionSideEffects
+):
+	SideEffectsCollector(_dialect, _functionSideEffects)
+{
+}
+
+MovableChecker::MovableChecker(
+	Dialect const& _dialect,
+	Expression const& _expression,
+	map<YulString, SideEffects> const* _functionSideEffects
+):
+	MovableChecker(_dialect, _functionSideEffects)
 {
 	visit(_expression);
 }
@@ -115,6 +270,30 @@ void MovableChecker::visit(Statement const&)
 	assertThrow(false, OptimizerException, "Movability for statement requested.");
 }
 
+set<YulString> TerminationFinder::terminatingFunctions(Dialect const& _dialect, Block const& _ast)
+{
+	map<YulString, FunctionDefinition const*> functions = FunctionDefinitionCollector::uniqueFunctions(_ast);
+
+	// Iterate until no new terminating functions are found, since functions
+	// can terminate by calling other terminating functions.
+	set<YulString> terminating;
+	TerminationFinder finder{_dialect, &terminating};
+	for (bool changed = true; changed;)
+	{
+		changed = false;
+		for (auto const& function: functions)
+			if (
+				!terminating.count(function.first) &&
+				finder.firstUnconditionalControlFlowChange(function.second->body.statements).first == ControlFlow::Terminate
+			)
+			{
+				terminating.insert(function.first);
+				changed = true;
+			}
+	}
+	return terminating;
+}
+
 pair<TerminationFinder::ControlFlow, size_t> TerminationFinder::firstUnconditionalControlFlowChange(
 	vector<Statement> const& _statements
 )
@@ -132,7 +311,10 @@ TerminationFinder::ControlFlow TerminationFinder::controlFlowKind(Statement cons
 {
 	if (
 		_statement.type() == typeid(ExpressionStatement) &&
-		isTerminatingBuiltin(boost::get<ExpressionStatement>(_statement))
+		(
+			isTerminatingBuiltin(boost::get<ExpressionStatement>(_statement)) ||
+			isTerminatingFunctionCall(boost::get<ExpressionStatement>(_statement))
+		)
 	)
 		return ControlFlow::Terminate;
 	else if (_statement.type() == typeid(Break))
@@ -156,3 +338,11 @@ bool TerminationFinder::isTerminatingBuiltin(ExpressionStatement const& _exprStm
 					return eth::SemanticInformation::terminatesControlFlow(*builtin->instruction);
 	return false;
 }
+
+bool TerminationFinder::isTerminatingFunctionCall(ExpressionStatement const& _exprStmnt)
+{
+	return
+		m_terminatingFunctions &&
+		_exprStmnt.expression.type() == typeid(FunctionCall) &&
+		m_terminatingFunctions->count(boost::get<FunctionCall>(_exprStmnt.expression).functionName.name);
+}
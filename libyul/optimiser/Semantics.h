@@ -22,59 +22,130 @@
 
 #include <libyul/optimiser/ASTWalker.h>
 
+#include <map>
 #include <set>
 
 namespace yul
 {
 struct Dialect;
 
+/**
+ * Side effects of a piece of code or of a call to a function.
+ */
+struct SideEffects
+{
+	/// The code is movable, i.e. it does not have side effects, can be freely
+	/// reordered with other movable code and always evaluates to the same value
+	/// (given the same values of the variables it references).
+	bool movable = true;
+	/// The code is side-effect free, i.e. can be removed without changing the semantics.
+	bool sideEffectFree = true;
+	/// The code is side-effect free up to msize, i.e. can be removed without changing
+	/// the semantics except for the value returned by the msize instruction.
+	bool sideEffectFreeIfNoMSize = true;
+	/// The code contains the msize instruction.
+	/// Note that this is a syntactic property that only takes the summaries of
+	/// called functions into account, but not the bodies of unknown functions.
+	bool containsMSize = false;
+	/// If false, storage is guaranteed to be unchanged by the code under all
+	/// circumstances.
+	bool invalidatesStorage = false;
+	bool invalidatesMemory = false;
+
+	/// @returns the side effects of a call to an unknown function.
+	/// This does not include the msize instruction, see containsMSize.
+	static SideEffects worst()
+	{
+		return SideEffects{false, false, false, false, true, true};
+	}
+
+	/// Adds the side effects of @a _other, which is executed before or after this code.
+	SideEffects& operator+=(SideEffects const& _other)
+	{
+		movable = movable && _other.movable;
+		sideEffectFree = sideEffectFree && _other.sideEffectFree;
+		sideEffectFreeIfNoMSize = sideEffectFreeIfNoMSize && _other.sideEffectFreeIfNoMSize;
+		containsMSize = containsMSize || _other.containsMSize;
+		invalidatesStorage = invalidatesStorage || _other.invalidatesStorage;
+		invalidatesMemory = invalidatesMemory || _other.invalidatesMemory;
+		return *this;
+	}
+};
+
 /**
  * Specific AST walker that determines side-effect free-ness and movability of code.
  * Enters into function definitions.
+ *
+ * Calls to user-defined functions use the side effects provided in @a _functionSideEffects
+ * (see SideEffectsPropagator) and are treated as having all side effects if they are
+ * not listed there.
  */
 class SideEffectsCollector: public ASTWalker
 {
 public:
-	explicit SideEffectsCollector(Dialect const& _dialect): m_dialect(_dialect) {}
-	SideEffectsCollector(Dialect const& _dialect, Expression const& _expression);
-	SideEffectsCollector(Dialect const& _dialect, Statement const& _statement);
-	SideEffectsCollector(Dialect const& _dialect, Block const& _ast);
+	explicit SideEffectsCollector(
+		Dialect const& _dialect,
+		std::map<YulString, SideEffects> const* _functionSideEffects = nullptr
+	): m_dialect(_dialect), m_functionSideEffects(_functionSideEffects) {}
+	SideEffectsCollector(
+		Dialect const& _dialect,
+		Expression const& _expression,
+		std::map<YulString, SideEffects> const* _functionSideEffects = nullptr
+	);
+	SideEffectsCollector(
+		Dialect const& _dialect,
+		Statement const& _statement,
+		std::map<YulString, SideEffects> const* _functionSideEffects = nullptr
+	);
+	SideEffectsCollector(
+		Dialect const& _dialect,
+		Block const& _ast,
+		std::map<YulString, SideEffects> const* _functionSideEffects = nullptr
+	);
 
 	using ASTWalker::operator();
 	void operator()(FunctionalInstruction const& _functionalInstruction) override;
 	void operator()(FunctionCall const& _functionCall) override;
 
-	bool movable() const { return m_movable; }
+	bool movable() const { return m_sideEffects.movable; }
 	bool sideEffectFree(bool _allowMSizeModification = false) const
 	{
 		if (_allowMSizeModification)
 			return sideEffectFreeIfNoMSize();
 		else
-			return m_sideEffectFree;
+			return m_sideEffects.sideEffectFree;
 	}
-	bool sideEffectFreeIfNoMSize() const { return m_sideEffectFreeIfNoMSize; }
-	bool containsMSize() const { return m_containsMSize; }
-	bool invalidatesStorage() const { return m_invalidatesStorage; }
-	bool invalidatesMemory() const { return m_invalidatesMemory; }
+	bool sideEffectFreeIfNoMSize() const { return m_sideEffects.sideEffectFreeIfNoMSize; }
+	bool containsMSize() const { return m_sideEffects.containsMSize; }
+	bool invalidatesStorage() const { return m_sideEffects.invalidatesStorage; }
+	bool invalidatesMemory() const { return m_sideEffects.invalidatesMemory; }
+
+	SideEffects const& sideEffects() const { return m_sideEffects; }
 
 private:
 	Dialect const& m_dialect;
-	/// Is the current expression movable or not.
-	bool m_movable = true;
-	/// Is the current expression side-effect free, i.e. can be removed
-	/// without changing the semantics.
-	bool m_sideEffectFree = true;
-	/// Is the current expression side-effect free up to msize, i.e. can be removed
-	/// without changing the semantics except for the value returned by the msize instruction.
-	bool m_sideEffectFreeIfNoMSize = true;
-	/// Does the current code contain the MSize operation?
-	/// Note that this is a purely syntactic property meaning that even if this is false,
-	/// the code can still contain calls to functions that contain the msize instruction.
-	bool m_containsMSize = false;
-	/// If false, storage is guaranteed to be unchanged by the coded under all
-	/// circumstances.
-	bool m_invalidatesStorage = false;
-	bool m_invalidatesMemory = false;
+	std::map<YulString, SideEffects> const* m_functionSideEffects = nullptr;
+	/// Side effects of the code visited so far.
+	SideEffects m_sideEffects;
+};
+
+/**
+ * Computes the side effects of all user-defined functions of an AST,
+ * including the side effects of the functions they (transitively) call.
+ *
+ * Functions that contain loops or are (mutually) recursive might not terminate
+ * and thus are neither movable nor side-effect free.
+ * Functions that are defined more than once (which cannot happen after the
+ * Disambiguator has run) are not included in the result.
+ *
+ * The result stays valid as long as the code of the functions is only modified
+ * in ways that do not add side effects, which is true for all optimiser steps
+ * that preserve semantics.
+ */
+class SideEffectsPropagator
+{
+public:
+	static std::map<YulString, SideEffects> sideEffects(Dialect const& _dialect, Block const& _ast);
 };
 
 /**
@@ -85,8 +156,15 @@ private:
 class MovableChecker: public SideEffectsCollector
 {
 public:
-	explicit MovableChecker(Dialect const& _dialect): SideEffectsCollector(_dialect) {}
-	MovableChecker(Dialect const& _dialect, Expression const& _expression);
+	explicit MovableChecker(
+		Dialect const& _dialect,
+		std::map<YulString, SideEffects> const* _functionSideEffects = nullptr
+	);
+	MovableChecker(
+		Dialect const& _dialect,
+		Expression const& _expression,
+		std::map<YulString, SideEffects> const* _functionSideEffects = nullptr
+	);
 
 	void operator()(Identifier const& _identifier) override;
 
@@ -111,11 +189,20 @@ class TerminationFinder
 public:
 	enum class ControlFlow { FlowOut, Break, Continue, Terminate };
 
-	TerminationFinder(Dialect const& _dialect): m_dialect(_dialect) {}
+	/// @param _terminatingFunctions user-defined functions that never return
+	/// (see terminatingFunctions), calls to them terminate as well.
+	TerminationFinder(
+		Dialect const& _dialect,
+		std::set<YulString> const* _terminatingFunctions = nullptr
+	): m_dialect(_dialect), m_terminatingFunctions(_terminatingFunctions) {}
+
+	/// @returns the names of the user-defined functions in @a _ast that
+	/// unconditionally terminate, i.e. calls to which never return.
+	static std::set<YulString> terminatingFunctions(Dialect const& _dialect, Block const& _ast);
 
 	/// @returns the index of the first statement in the provided sequence
 	/// that is an unconditional ``break``, ``continue`` or a
-	/// call to a terminating builtin function.
+	/// call to a terminating builtin or user-defined function.
 	/// If control flow can continue at the end of the list,
 	/// returns `FlowOut` and ``size_t(-1)``.
 	/// The function might return ``FlowOut`` even though control
@@ -133,8 +220,13 @@ public:
 	/// ``stop``, ``revert`` or ``return``.
 	bool isTerminatingBuiltin(ExpressionStatement const& _exprStmnt);
 
+	/// @returns true if the expression statement is a direct
+	/// call to a user-defined function that never returns.
+	bool isTerminatingFunctionCall(ExpressionStatement const& _exprStmnt);
+
 private:
 	Dialect const& m_dialect;
+	std::set<YulString> const* m_terminatingFunctions = nullptr;
 };
 
 }
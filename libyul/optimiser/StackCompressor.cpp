@@ -165,9 +165,25 @@ bool StackCompressor::run(
 		"Need to run the function grouper before the stack compressor."
 	);
 	bool allowMSizeOptimzation = !SideEffectsCollector(_dialect, _ast).containsMSize();
+	map<YulString, int> stackSurplus = CompilabilityChecker::run(_dialect, _ast, _optimizeStackAllocation);
 	for (size_t iterations = 0; iterations < _maxIterations; iterations++)
 	{
-		map<YulString, int> stackSurplus = CompilabilityChecker::run(_dialect, _ast, _optimizeStackAllocation);
+		if (iterations > 0)
+		{
+			// The code transform stops at the outermost block if that has a stack surplus,
+			// so the functions have not been checked yet in that case. Otherwise, only
+			// the functions that had a stack surplus were modified in the previous
+			// iteration, all others are still compilable.
+			if (stackSurplus.count(YulString{}))
+				stackSurplus = CompilabilityChecker::run(_dialect, _ast, _optimizeStackAllocation);
+			else
+			{
+				set<YulString> modifiedFunctions;
+				for (auto const& surplus: stackSurplus)
+					modifiedFunctions.insert(surplus.first);
+				stackSurplus = CompilabilityChecker::run(_dialect, _ast, _optimizeStackAllocation, modifiedFunctions);
+			}
+		}
 		if (stackSurplus.empty())
 			return true;
 
@@ -71,13 +71,14 @@ void OptimiserSuite::run(
 	set<YulString> reservedIdentifiers = _externallyUsedIdentifiers;
 	reservedIdentifiers += _dialect.fixedFunctionNames();
 
-	Block ast = boost::get<Block>(Disambiguator(_dialect, _analysisInfo, reservedIdentifiers)(_ast));
+	Disambiguator::run(_dialect, _ast, _analysisInfo, reservedIdentifiers);
+	Block& ast = _ast;
 
 	VarDeclInitializer{}(ast);
 	FunctionHoister{}(ast);
 	BlockFlattener{}(ast);
 	ForLoopInitRewriter{}(ast);
-	DeadCodeEliminator{_dialect}(ast);
+	DeadCodeEliminator::run(_dialect, ast);
 	FunctionGrouper{}(ast);
 	EquivalentFunctionCombiner::run(ast);
 	UnusedPruner::runUntilStabilised(_dialect, ast, reservedIdentifiers);
@@ -109,7 +110,7 @@ void OptimiserSuite::run(
 			RedundantAssignEliminator::run(_dialect, ast);
 
 			ExpressionSimplifier::run(_dialect, ast);
-			CommonSubexpressionEliminator{_dialect}(ast);
+			CommonSubexpressionEliminator::run(_dialect, ast);
 		}
 
 		{
@@ -118,19 +119,19 @@ void OptimiserSuite::run(
 			StructuralSimplifier{_dialect}(ast);
 			ControlFlowSimplifier{_dialect}(ast);
 			BlockFlattener{}(ast);
-			DeadCodeEliminator{_dialect}(ast);
+			DeadCodeEliminator::run(_dialect, ast);
 			UnusedPruner::runUntilStabilised(_dialect, ast, reservedIdentifiers);
 		}
 		{
 			// simplify again
-			CommonSubexpressionEliminator{_dialect}(ast);
+			CommonSubexpressionEliminator::run(_dialect, ast);
 			UnusedPruner::runUntilStabilised(_dialect, ast, reservedIdentifiers);
 		}
 
 		{
 			// reverse SSA
 			SSAReverser::run(ast);
-			CommonSubexpressionEliminator{_dialect}(ast);
+			CommonSubexpressionEliminator::run(_dialect, ast);
 			UnusedPruner::runUntilStabilised(_dialect, ast, reservedIdentifiers);
 
 			ExpressionJoiner::run(ast);
@@ -151,14 +152,14 @@ void OptimiserSuite::run(
 			SSATransform::run(ast, dispenser);
 			RedundantAssignEliminator::run(_dialect, ast);
 			RedundantAssignEliminator::run(_dialect, ast);
-			CommonSubexpressionEliminator{_dialect}(ast);
+			CommonSubexpressionEliminator::run(_dialect, ast);
 		}
 
 		{
 			// run full inliner
 			FunctionGrouper{}(ast);
 			EquivalentFunctionCombiner::run(ast);
-			FullInliner{ast, dispenser}.run();
+			FullInliner{ast, dispenser, _meter}.run();
 			BlockFlattener{}(ast);
 		}
 
@@ -170,14 +171,14 @@ void OptimiserSuite::run(
 			ExpressionSimplifier::run(_dialect, ast);
 			StructuralSimplifier{_dialect}(ast);
 			BlockFlattener{}(ast);
-			DeadCodeEliminator{_dialect}(ast);
+			DeadCodeEliminator::run(_dialect, ast);
 			ControlFlowSimplifier{_dialect}(ast);
-			CommonSubexpressionEliminator{_dialect}(ast);
+			CommonSubexpressionEliminator::run(_dialect, ast);
 			SSATransform::run(ast, dispenser);
 			RedundantAssignEliminator::run(_dialect, ast);
 			RedundantAssignEliminator::run(_dialect, ast);
 			UnusedPruner::runUntilStabilised(_dialect, ast, reservedIdentifiers);
-			CommonSubexpressionEliminator{_dialect}(ast);
+			CommonSubexpressionEliminator::run(_dialect, ast);
 		}
 	}
 
@@ -192,7 +193,7 @@ void OptimiserSuite::run(
 	UnusedPruner::runUntilStabilised(_dialect, ast, reservedIdentifiers);
 
 	SSAReverser::run(ast);
-	CommonSubexpressionEliminator{_dialect}(ast);
+	CommonSubexpressionEliminator::run(_dialect, ast);
 	UnusedPruner::runUntilStabilised(_dialect, ast, reservedIdentifiers);
 
 	ExpressionJoiner::run(ast);
@@ -206,7 +207,7 @@ void OptimiserSuite::run(
 	// message once we perform code generation.
 	StackCompressor::run(_dialect, ast, _optimizeStackAllocation, stackCompressorMaxIterations);
 	BlockFlattener{}(ast);
-	DeadCodeEliminator{_dialect}(ast);
+	DeadCodeEliminator::run(_dialect, ast);
 	ControlFlowSimplifier{_dialect}(ast);
 
 	FunctionGrouper{}(ast);
@@ -225,6 +226,4 @@ void OptimiserSuite::run(
 	}
 	VarNameCleaner{ast, _dialect, reservedIdentifiers}(ast);
 	yul::AsmAnalyzer::analyzeStrictAssertCorrect(_dialect, ast);
-
-	_ast = std::move(ast);
 }
@@ -33,30 +33,37 @@ using namespace std;
 using namespace dev;
 using namespace yul;
 
-UnusedPruner::UnusedPruner(
-	Dialect const& _dialect,
-	Block& _ast,
-	bool _allowMSizeOptimization,
-	set<YulString> const& _externallyUsedFunctions
-):
-	m_dialect(_dialect),
-	m_allowMSizeOptimization(_allowMSizeOptimization)
+namespace
 {
-	m_references = ReferencesCounter::countReferences(_ast);
-	for (auto const& f: _externallyUsedFunctions)
-		++m_references[f];
+
+/**
+ * Removes all empty blocks, also those that only became empty by removing nested ones.
+ */
+class EmptyBlockRemover: public ASTModifier
+{
+public:
+	using ASTModifier::operator();
+	void operator()(Block& _block) override
+	{
+		ASTModifier::operator()(_block);
+		removeEmptyBlocks(_block);
+	}
+};
+
 }
 
 UnusedPruner::UnusedPruner(
 	Dialect const& _dialect,
-	FunctionDefinition& _function,
+	map<YulString, size_t> _references,
 	bool _allowMSizeOptimization,
-	set<YulString> const& _externallyUsedFunctions
+	set<YulString> const& _externallyUsedFunctions,
+	map<YulString, SideEffects> const* _functionSideEffects
 ):
 	m_dialect(_dialect),
-	m_allowMSizeOptimization(_allowMSizeOptimization)
+	m_functionSideEffects(_functionSideEffects),
+	m_allowMSizeOptimization(_allowMSizeOptimization),
+	m_references(std::move(_references))
 {
-	m_references = ReferencesCounter::countReferences(_function);
 	for (auto const& f: _externallyUsedFunctions)
 		++m_references[f];
 }
@@ -64,54 +71,14 @@ UnusedPruner::UnusedPruner(
 void UnusedPruner::operator()(Block& _block)
 {
 	for (auto&& statement: _block.statements)
+	{
+		prune(statement);
 		if (statement.type() == typeid(FunctionDefinition))
-		{
-			FunctionDefinition& funDef = boost::get<FunctionDefinition>(statement);
-			if (!used(funDef.name))
-			{
-				subtractReferences(ReferencesCounter::countReferences(funDef.body));
-				statement = Block{std::move(funDef.location), {}};
-			}
-		}
+			m_declarations[boost::get<FunctionDefinition>(statement).name] = &statement;
 		else if (statement.type() == typeid(VariableDeclaration))
-		{
-			VariableDeclaration& varDecl = boost::get<VariableDeclaration>(statement);
-			// Multi-variable declarations are special. We can only remove it
-			// if all variables are unused and the right-hand-side is either
-			// movable or it returns a single value. In the latter case, we
-			// replace `let a := f()` by `pop(f())` (in pure Yul, this will be
-			// `drop(f())`).
-			if (boost::algorithm::none_of(
-				varDecl.variables,
-				[=](TypedName const& _typedName) { return used(_typedName.name); }
-			))
-			{
-				if (!varDecl.value)
-					statement = Block{std::move(varDecl.location), {}};
-				else if (SideEffectsCollector(m_dialect, *varDecl.value).sideEffectFree(m_allowMSizeOptimization))
-				{
-					subtractReferences(ReferencesCounter::countReferences(*varDecl.value));
-					statement = Block{std::move(varDecl.location), {}};
-				}
-				else if (varDecl.variables.size() == 1 && m_dialect.discardFunction())
-					statement = ExpressionStatement{varDecl.location, FunctionCall{
-						varDecl.location,
-						{varDecl.location, m_dialect.discardFunction()->name},
-						{*std::move(varDecl.value)}
-					}};
-			}
-		}
-		else if (statement.type() == typeid(ExpressionStatement))
-		{
-			ExpressionStatement& exprStmt = boost::get<ExpressionStatement>(statement);
-			if (SideEffectsCollector(m_dialect, exprStmt.expression).sideEffectFree(m_allowMSizeOptimization))
-			{
-				subtractReferences(ReferencesCounter::countReferences(exprStmt.expression));
-				statement = Block{std::move(exprStmt.location), {}};
-			}
-		}
-
-	removeEmptyBlocks(_block);
+			for (auto const& var: boost::get<VariableDeclaration>(statement).variables)
+				m_declarations[var.name] = &statement;
+	}
 
 	ASTModifier::operator()(_block);
 }
@@ -124,14 +91,20 @@ void UnusedPruner::runUntilStabilised(
 )
 {
 	_allowMSizeOptization = !SideEffectsCollector(_dialect, _ast).containsMSize();
-
-	while (true)
-	{
-		UnusedPruner pruner(_dialect, _ast, _allowMSizeOptization, _externallyUsedFunctions);
-		pruner(_ast);
-		if (!pruner.shouldRunAgain())
-			return;
-	}
+	// Removing unused code does not add side effects, so the summaries
+	// stay valid while pruning.
+	map<YulString, SideEffects> functionSideEffects = SideEffectsPropagator::sideEffects(_dialect, _ast);
+
+	UnusedPruner pruner(
+		_dialect,
+		ReferencesCounter::countReferences(_ast),
+		_allowMSizeOptization,
+		_externallyUsedFunctions,
+		&functionSideEffects
+	);
+	pruner(_ast);
+	pruner.pruneNewlyUnused();
+	EmptyBlockRemover{}(_ast);
 }
 
 void UnusedPruner::runUntilStabilised(
@@ -151,12 +124,87 @@ void UnusedPruner::runUntilStabilised(
 	set<YulString> const& _externallyUsedFunctions
 )
 {
-	while (true)
+	UnusedPruner pruner(
+		_dialect,
+		ReferencesCounter::countReferences(_function),
+		_allowMSizeOptimization,
+		_externallyUsedFunctions,
+		nullptr
+	);
+	pruner(_function);
+	pruner.pruneNewlyUnused();
+	EmptyBlockRemover{}(_function);
+}
+
+void UnusedPruner::prune(Statement& _statement)
+{
+	if (_statement.type() == typeid(FunctionDefinition))
+	{
+		FunctionDefinition& funDef = boost::get<FunctionDefinition>(_statement);
+		if (!used(funDef.name))
+		{
+			// The body is destroyed, so forget the declarations inside.
+			for (auto const& name: NameCollector{funDef.body}.names())
+				m_declarations.erase(name);
+			subtractReferences(ReferencesCounter::countReferences(funDef.body));
+			_statement = Block{std::move(funDef.location), {}};
+		}
+	}
+	else if (_statement.type() == typeid(VariableDeclaration))
+	{
+		VariableDeclaration& varDecl = boost::get<VariableDeclaration>(_statement);
+		// Multi-variable declarations are special. We can only remove it
+		// if all variables are unused and the right-hand-side is either
+		// movable or it returns a single value. In the latter case, we
+		// replace `let a := f()` by `pop(f())` (in pure Yul, this will be
+		// `drop(f())`).
+		if (boost::algorithm::none_of(
+			varDecl.variables,
+			[=](TypedName const& _typedName) { return used(_typedName.name); }
+		))
+		{
+			if (!varDecl.value)
+				_statement = Block{std::move(varDecl.location), {}};
+			else if (
+				SideEffectsCollector(m_dialect, *varDecl.value, m_functionSideEffects).
+				sideEffectFree(m_allowMSizeOptimization)
+			)
+			{
+				subtractReferences(ReferencesCounter::countReferences(*varDecl.value));
+				_statement = Block{std::move(varDecl.location), {}};
+			}
+			else if (varDecl.variables.size() == 1 && m_dialect.discardFunction())
+				_statement = ExpressionStatement{varDecl.location, FunctionCall{
+					varDecl.location,
+					{varDecl.location, m_dialect.discardFunction()->name},
+					{*std::move(varDecl.value)}
+				}};
+		}
+	}
+	else if (_statement.type() == typeid(ExpressionStatement))
+	{
+		ExpressionStatement& exprStmt = boost::get<ExpressionStatement>(_statement);
+		if (
+			SideEffectsCollector(m_dialect, exprStmt.expression, m_functionSideEffects).
+			sideEffectFree(m_allowMSizeOptimization)
+		)
+		{
+			subtractReferences(ReferencesCounter::countReferences(exprStmt.expression));
+			_statement = Block{std::move(exprStmt.location), {}};
+		}
+	}
+}
+
+void UnusedPruner::pruneNewlyUnused()
+{
+	while (!m_unusedNames.empty())
 	{
-		UnusedPruner pruner(_dialect, _function, _allowMSizeOptimization, _externallyUsedFunctions);
-		pruner(_function);
-		if (!pruner.shouldRunAgain())
-			return;
+		YulString name = m_unusedNames.back();
+		m_unusedNames.pop_back();
+		// Parameters and declarations inside removed functions are not found.
+		auto it = m_declarations.find(name);
+		if (it != m_declarations.end())
+			prune(*it->second);
 	}
 }
 
@@ -172,6 +220,7 @@ void UnusedPruner::subtractReferences(map<YulString, size_t> const& _subtrahend)
 		assertThrow(m_references.count(ref.first), OptimizerException, "");
 		assertThrow(m_references.at(ref.first) >= ref.second, OptimizerException, "");
 		m_references[ref.first] -= ref.second;
-		m_shouldRunAgain = true;
+		if (m_references[ref.first] == 0)
+			m_unusedNames.emplace_back(ref.first);
 	}
 }
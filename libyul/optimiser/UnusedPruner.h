@@ -21,10 +21,12 @@
 #pragma once
 
 #include <libyul/optimiser/ASTWalker.h>
+#include <libyul/optimiser/Semantics.h>
 #include <libyul/YulString.h>
 
 #include <map>
 #include <set>
+#include <vector>
 
 namespace yul
 {
@@ -36,30 +38,18 @@ struct Dialect;
  *
  * Note that this does not remove circular references.
  *
+ * Calls to user-defined functions are removed if the side effects provided
+ * for them (see SideEffectsPropagator) show that they are side-effect free.
+ *
+ * References are counted only once. Whenever the references of a name drop
+ * to zero because code is removed, its declaration is pruned again, so that
+ * the fixpoint is reached without walking the code repeatedly.
+ *
  * Prerequisite: Disambiguator
  */
 class UnusedPruner: public ASTModifier
 {
 public:
-	UnusedPruner(
-		Dialect const& _dialect,
-		Block& _ast,
-		bool _allowMSizeOptimization,
-		std::set<YulString> const& _externallyUsedFunctions = {}
-	);
-	UnusedPruner(
-		Dialect const& _dialect,
-		FunctionDefinition& _function,
-		bool _allowMSizeOptimization,
-		std::set<YulString> const& _externallyUsedFunctions = {}
-	);
-
-	using ASTModifier::operator();
-	void operator()(Block& _block) override;
-
-	// @returns true iff the code changed in the previous run.
-	bool shouldRunAgain() const { return m_shouldRunAgain; }
-
 	// Run the pruner until the code does not change anymore.
 	static void runUntilStabilised(
 		Dialect const& _dialect,
@@ -86,14 +76,38 @@ public:
 		std::set<YulString> const& _externallyUsedFunctions = {}
 	);
 
+	using ASTModifier::operator();
+	void operator()(Block& _block) override;
+
 private:
+	UnusedPruner(
+		Dialect const& _dialect,
+		std::map<YulString, size_t> _references,
+		bool _allowMSizeOptimization,
+		std::set<YulString> const& _externallyUsedFunctions,
+		std::map<YulString, SideEffects> const* _functionSideEffects
+	);
+
+	/// Removes the statement if it is an unused declaration or a side-effect free
+	/// expression statement.
+	void prune(Statement& _statement);
+	/// Prunes the declarations of the names whose references dropped to zero
+	/// after they have been visited, until no more names become unused.
+	void pruneNewlyUnused();
+
 	bool used(YulString _name) const;
 	void subtractReferences(std::map<YulString, size_t> const& _subtrahend);
 
 	Dialect const& m_dialect;
+	std::map<YulString, SideEffects> const* m_functionSideEffects = nullptr;
 	bool m_allowMSizeOptimization = false;
-	bool m_shouldRunAgain = false;
 	std::map<YulString, size_t> m_references;
+	/// Statements declaring the visited functions and variables.
+	/// Statements are replaced by empty blocks and only removed at the end,
+	/// so that the pointers stay valid.
+	std::map<YulString, Statement*> m_declarations;
+	/// Names whose references dropped to zero.
+	std::vector<YulString> m_unusedNames;
 };
 
 }
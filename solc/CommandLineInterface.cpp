@@ -505,13 +505,13 @@ bool CommandLineInterface::readInputFilesAndConfigureRemappings()
 					continue;
 				}
 
-				m_sourceCodes[infile.generic_string()] = dev::readFileAsString(infile.string());
+				m_sourceCodes[infile.generic_string()] = make_shared<string const>(dev::readFileAsString(infile.string()));
 				path = boost::filesystem::canonical(infile).string();
 			}
 			m_allowedDirectories.push_back(boost::filesystem::path(path).remove_filename());
 		}
 	if (addStdin)
-		m_sourceCodes[g_stdinFileName] = dev::readStandardInput();
+		m_sourceCodes[g_stdinFileName] = make_shared<string const>(dev::readStandardInput());
 	if (m_sourceCodes.size() == 0)
 	{
 		serr() << "No input files given. If you wish to use the standard input please specify \"-\" explicitly." << endl;
@@ -610,6 +610,14 @@ void CommandLineInterface::createJson(string const& _fileName, string const& _js
 	createFile(boost::filesystem::basename(_fileName) + string(".json"), _json);
 }
 
+StringMap const& CommandLineInterface::sourceCodeStrings()
+{
+	if (m_sourceCodeStrings.empty())
+		for (auto const& source: m_sourceCodes)
+			m_sourceCodeStrings[source.first] = *source.second;
+	return m_sourceCodeStrings;
+}
+
 bool CommandLineInterface::parseArguments(int _argc, char** _argv)
 {
 	g_hasOutput = false;
@@ -820,9 +828,9 @@ bool CommandLineInterface::processInput()
 			if (!boost::filesystem::is_regular_file(canonicalPath))
 				return ReadCallback::Result{false, "Not a valid file."};
 
-			auto contents = dev::readFileAsString(canonicalPath.string());
+			auto contents = make_shared<string const>(dev::readFileAsString(canonicalPath.string()));
 			m_sourceCodes[path.generic_string()] = contents;
-			return ReadCallback::Result{true, contents};
+			return ReadCallback::Result{true, *contents};
 		}
 		catch (Exception const& _exception)
 		{
@@ -854,7 +862,8 @@ bool CommandLineInterface::processInput()
 	{
 		string input = dev::readStandardInput();
 		StandardCompiler compiler(fileReader);
-		sout() << compiler.compile(std::move(input)) << endl;
+		compiler.compile(input, sout());
+		sout() << endl;
 		return true;
 	}
 
@@ -940,7 +949,7 @@ bool CommandLineInterface::processInput()
 			m_compiler->useMetadataLiteralSources(true);
 		if (m_args.count(g_argInputFile))
 			m_compiler->setRemappings(m_remappings);
-		m_compiler->setSources(m_sourceCodes);
+		m_compiler->setSourceBuffers(m_sourceCodes);
 		if (m_args.count(g_argLibraries))
 			m_compiler->setLibraries(m_libraries);
 		if (m_args.count(g_argErrorRecovery))
@@ -1051,7 +1060,7 @@ void CommandLineInterface::handleCombinedJSON()
 		if (requests.count(g_strOpcodes))
 			contractData[g_strOpcodes] = dev::eth::disassemble(m_compiler->object(contractName).bytecode);
 		if (requests.count(g_strAsm))
-			contractData[g_strAsm] = m_compiler->assemblyJSON(contractName, m_sourceCodes);
+			contractData[g_strAsm] = m_compiler->assemblyJSON(contractName, sourceCodeStrings());
 		if (requests.count(g_strSrcMap))
 		{
 			auto map = m_compiler->sourceMapping(contractName);
@@ -1140,7 +1149,7 @@ void CommandLineInterface::handleAst(string const& _argStr)
 				string postfix = "";
 				if (_argStr == g_argAst)
 				{
-					ASTPrinter printer(m_compiler->ast(sourceCode.first), sourceCode.second);
+					ASTPrinter printer(m_compiler->ast(sourceCode.first), *sourceCode.second);
 					printer.print(data);
 				}
 				else
@@ -1162,7 +1171,7 @@ void CommandLineInterface::handleAst(string const& _argStr)
 				{
 					ASTPrinter printer(
 						m_compiler->ast(sourceCode.first),
-						sourceCode.second,
+						*sourceCode.second,
 						gasCosts
 					);
 					printer.print(sout());
@@ -1209,14 +1218,15 @@ bool CommandLineInterface::link()
 	}
 	for (auto& src: m_sourceCodes)
 	{
-		auto end = src.second.end();
-		for (auto it = src.second.begin(); it != end;)
+		string source = *src.second;
+		auto end = source.end();
+		for (auto it = source.begin(); it != end;)
 		{
 			while (it != end && *it != '_') ++it;
 			if (it == end) break;
 			if (end - it < placeholderSize)
 			{
-				serr() << "Error in binary object file " << src.first << " at position " << (end - src.second.begin()) << endl;
+				serr() << "Error in binary object file " << src.first << " at position " << (end - source.begin()) << endl;
 				return false;
 			}
 
@@ -1232,9 +1242,10 @@ bool CommandLineInterface::link()
 		}
 		// Remove hints for resolved libraries.
 		for (auto const& library: m_libraries)
-			boost::algorithm::erase_all(src.second, "\n" + libraryPlaceholderHint(library.first));
-		while (!src.second.empty() && *prev(src.second.end()) == '\n')
-			src.second.resize(src.second.size() - 1);
+			boost::algorithm::erase_all(source, "\n" + libraryPlaceholderHint(library.first));
+		while (!source.empty() && *prev(source.end()) == '\n')
+			source.resize(source.size() - 1);
+		src.second = make_shared<string const>(move(source));
 	}
 	return true;
 }
@@ -1243,11 +1254,11 @@ void CommandLineInterface::writeLinkedFiles()
 {
 	for (auto const& src: m_sourceCodes)
 		if (src.first == g_stdinFileName)
-			sout() << src.second << endl;
+			sout() << *src.second << endl;
 		else
 		{
 			ofstream outFile(src.first);
-			outFile << src.second;
+			outFile << *src.second;
 			if (!outFile)
 			{
 				serr() << "Could not write to file " << src.first << ". Aborting." << endl;
@@ -1291,7 +1302,7 @@ bool CommandLineInterface::assemble(
 		);
 		try
 		{
-			if (!stack.parseAndAnalyze(src.first, src.second))
+			if (!stack.parseAndAnalyze(src.first, *src.second))
 				successful = false;
 			else
 				stack.optimize();
@@ -1408,9 +1419,9 @@ void CommandLineInterface::outputCompilationResults()
 		{
 			string ret;
 			if (m_args.count(g_argAsmJson))
-				ret = dev::jsonPrettyPrint(m_compiler->assemblyJSON(contract, m_sourceCodes));
+				ret = dev::jsonPrettyPrint(m_compiler->assemblyJSON(contract, sourceCodeStrings()));
 			else
-				ret = m_compiler->assemblyString(contract, m_sourceCodes);
+				ret = m_compiler->assemblyString(contract, sourceCodeStrings());
 
 			if (m_args.count(g_argOutputDir))
 			{
@@ -81,6 +81,10 @@ private:
 	/// It then tries to parse the contents and appends to m_libraries.
 	bool parseLibraryOption(std::string const& _input);
 
+	/// @returns copies of the sources as strings, as required by the assembly output.
+	/// They are only created on the first call.
+	StringMap const& sourceCodeStrings();
+
 	/// Create a file in the given directory
 	/// @arg _fileName the name of the file
 	/// @arg _data to be written
@@ -99,8 +103,10 @@ private:
 
 	/// Compiler arguments variable map
 	boost::program_options::variables_map m_args;
-	/// map of input files to source code strings
-	std::map<std::string, std::string> m_sourceCodes;
+	/// map of input files to source code buffers, which are shared with the compiler stack
+	std::map<std::string, std::shared_ptr<std::string const>> m_sourceCodes;
+	/// copies of @a m_sourceCodes as strings, see sourceCodeStrings()
+	StringMap m_sourceCodeStrings;
 	/// list of remappings
 	std::vector<dev::solidity::CompilerStack::Remapping> m_remappings;
 	/// list of allowed directories to read files from
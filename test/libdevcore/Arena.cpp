@@ -0,0 +1,74 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+/**
+ * Unit tests for the memory arena.
+ */
+
+#include <libdevcore/Arena.h>
+
+#include <test/Options.h>
+
+#include <cstdint>
+#include <string>
+
+using namespace std;
+
+namespace dev
+{
+namespace test
+{
+
+BOOST_AUTO_TEST_SUITE(ArenaTest)
+
+BOOST_AUTO_TEST_CASE(alignment)
+{
+	Arena arena(128);
+	for (size_t alignment: {1, 2, 4, 8, 16, 32})
+		for (size_t size: {1, 3, 7, 20})
+		{
+			void* p = arena.allocate(size, alignment);
+			BOOST_CHECK_EQUAL(reinterpret_cast<uintptr_t>(p) % alignment, 0);
+		}
+}
+
+BOOST_AUTO_TEST_CASE(large_allocation)
+{
+	Arena arena(64);
+	char* small = static_cast<char*>(arena.allocate(8, 1));
+	char* large = static_cast<char*>(arena.allocate(1000, 1));
+	char* next = static_cast<char*>(arena.allocate(8, 1));
+	// The large object does not discard the current block.
+	BOOST_CHECK(next == small + 8);
+	BOOST_CHECK(large != nullptr);
+	BOOST_CHECK(arena.reservedBytes() >= 1064);
+}
+
+BOOST_AUTO_TEST_CASE(shared_pointers_keep_arena_alive)
+{
+	shared_ptr<string> s;
+	{
+		auto arena = make_shared<Arena>();
+		s = allocate_shared<string>(ArenaAllocator<string>(arena), "arena allocated string");
+	}
+	BOOST_CHECK_EQUAL(*s, "arena allocated string");
+	s.reset();
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}
+}
@@ -0,0 +1,187 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+/**
+ * Unit tests for the fixed-width 256 bit integers, compared against boost's u256.
+ */
+
+#include <libdevcore/FixedU256.h>
+
+#include <test/Options.h>
+
+#include <random>
+#include <vector>
+
+using namespace std;
+
+namespace dev
+{
+namespace test
+{
+
+namespace
+{
+
+/// @returns random values biased towards the edge cases of the limb-wise algorithms:
+/// zero and saturated limbs, small values and values close to 2**255.
+vector<u256> randomValues(size_t _count)
+{
+	mt19937_64 generator(1);
+	vector<u256> values{0, 1, 2, u256(1) << 63, u256(1) << 64, u256(1) << 255, ~u256(0)};
+	while (values.size() < _count)
+	{
+		u256 value;
+		for (size_t i = 0; i < 4; ++i)
+		{
+			value <<= 64;
+			switch (generator() % 4)
+			{
+			case 0: break;
+			case 1: value |= ~uint64_t(0); break;
+			case 2: value |= generator() % 16; break;
+			default: value |= generator(); break;
+			}
+		}
+		values.push_back(value);
+	}
+	return values;
+}
+
+s256 signedValue(u256 const& _value)
+{
+	return boost::multiprecision::bit_test(_value, 255) ? -s256(~_value + 1) : s256(_value);
+}
+
+u256 unsignedValue(s256 const& _value)
+{
+	return _value < 0 ? u256(~u256(-_value) + 1) : u256(_value);
+}
+
+}
+
+BOOST_AUTO_TEST_SUITE(FixedU256Test)
+
+BOOST_AUTO_TEST_CASE(conversion)
+{
+	for (u256 const& value: randomValues(200))
+	{
+		BOOST_CHECK_EQUAL(u256(FixedU256(value)), value);
+		for (unsigned i = 0; i < 256; i += 17)
+			BOOST_CHECK_EQUAL(FixedU256(value).bit(i), boost::multiprecision::bit_test(value, i));
+	}
+	BOOST_CHECK(FixedU256(u256(5)) == FixedU256(5));
+}
+
+BOOST_AUTO_TEST_CASE(arithmetic)
+{
+	vector<u256> values = randomValues(80);
+	for (u256 const& a: values)
+		for (u256 const& b: values)
+		{
+			FixedU256 fa(a);
+			FixedU256 fb(b);
+			BOOST_CHECK_EQUAL(u256(fa + fb), u256(a + b));
+			BOOST_CHECK_EQUAL(u256(fa - fb), u256(a - b));
+			BOOST_CHECK_EQUAL(u256(fa * fb), u256(a * b));
+			BOOST_CHECK_EQUAL(u256(fa / fb), b == 0 ? u256(0) : u256(a / b));
+			BOOST_CHECK_EQUAL(u256(fa % fb), b == 0 ? u256(0) : u256(a % b));
+			BOOST_CHECK_EQUAL(u256(fa & fb), u256(a & b));
+			BOOST_CHECK_EQUAL(u256(fa | fb), u256(a | b));
+			BOOST_CHECK_EQUAL(u256(fa ^ fb), u256(a ^ b));
+			BOOST_CHECK_EQUAL(fa < fb, a < b);
+			BOOST_CHECK_EQUAL(fa == fb, a == b);
+		}
+}
+
+BOOST_AUTO_TEST_CASE(modular_arithmetic)
+{
+	vector<u256> values = randomValues(30);
+	for (u256 const& a: values)
+		for (u256 const& b: values)
+			for (u256 const& m: values)
+			{
+				FixedU256 fa(a);
+				FixedU256 fb(b);
+				FixedU256 fm(m);
+				u256 expectedAdd = m == 0 ? 0 : u256((bigint(a) + b) % m);
+				u256 expectedMul = m == 0 ? 0 : u256((bigint(a) * b) % m);
+				BOOST_CHECK_EQUAL(u256(FixedU256::addMod(fa, fb, fm)), expectedAdd);
+				BOOST_CHECK_EQUAL(u256(FixedU256::mulMod(fa, fb, fm)), expectedMul);
+			}
+}
+
+BOOST_AUTO_TEST_CASE(exponentiation)
+{
+	vector<u256> values = randomValues(40);
+	values.push_back(3);
+	values.push_back(255);
+	for (u256 const& base: values)
+		for (u256 const& exponent: values)
+		{
+			bigint modulus = bigint(1) << 256;
+			u256 expected(boost::multiprecision::powm(bigint(base), bigint(exponent), modulus));
+			FixedU256 result = FixedU256::exp(FixedU256(base), FixedU256(exponent));
+			BOOST_CHECK_EQUAL(u256(result), expected);
+		}
+}
+
+BOOST_AUTO_TEST_CASE(signed_arithmetic)
+{
+	vector<u256> values = randomValues(80);
+	for (u256 const& a: values)
+		for (u256 const& b: values)
+		{
+			FixedU256 fa(a);
+			FixedU256 fb(b);
+			s256 sa = signedValue(a);
+			s256 sb = signedValue(b);
+			u256 expectedDiv = b == 0 ? 0 : unsignedValue(s256(bigint(sa) / sb));
+			u256 expectedMod = b == 0 ? 0 : unsignedValue(sa % sb);
+			BOOST_CHECK_EQUAL(u256(FixedU256::signedDiv(fa, fb)), expectedDiv);
+			BOOST_CHECK_EQUAL(u256(FixedU256::signedMod(fa, fb)), expectedMod);
+			BOOST_CHECK_EQUAL(FixedU256::signedLessThan(fa, fb), sa < sb);
+		}
+	// The only overflowing case wraps around.
+	FixedU256 minimum(u256(1) << 255);
+	BOOST_CHECK(FixedU256::signedDiv(minimum, ~FixedU256()) == minimum);
+}
+
+BOOST_AUTO_TEST_CASE(shifts)
+{
+	for (u256 const& value: randomValues(40))
+		for (unsigned amount: {0u, 1u, 63u, 64u, 65u, 127u, 128u, 200u, 255u, 256u, 1000u})
+		{
+			FixedU256 fixed(value);
+			u256 expectedLeft = amount >= 256 ? 0 : u256(value << amount);
+			u256 expectedRight = amount >= 256 ? 0 : u256(value >> amount);
+			BOOST_CHECK_EQUAL(u256(fixed << amount), expectedLeft);
+			BOOST_CHECK_EQUAL(u256(fixed >> amount), expectedRight);
+			// Arithmetic shifts round towards negative infinity.
+			bigint magnitude = bigint(signedValue(value));
+			bigint expected;
+			if (magnitude >= 0)
+				expected = amount >= 256 ? 0 : bigint(magnitude >> amount);
+			else
+				expected = amount >= 256 ? -1 : bigint(-((-magnitude - 1) >> amount) - 1);
+			FixedU256 shifted = FixedU256::arithmeticShiftRight(fixed, amount);
+			BOOST_CHECK_EQUAL(u256(shifted), unsignedValue(s256(expected)));
+		}
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}
+}
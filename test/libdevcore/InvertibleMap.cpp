@@ -0,0 +1,81 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+/**
+ * Unit tests for the invertible map.
+ */
+
+#include <libdevcore/InvertibleMap.h>
+
+#include <test/Options.h>
+
+#include <string>
+
+using namespace std;
+
+namespace dev
+{
+namespace test
+{
+
+BOOST_AUTO_TEST_SUITE(InvertibleMapTest)
+
+BOOST_AUTO_TEST_CASE(references)
+{
+	InvertibleMap<int, string> map;
+	map.set(1, "a");
+	map.set(2, "a");
+	map.set(3, "b");
+	BOOST_CHECK_EQUAL(map.references["a"].size(), 2);
+	map.eraseValue("a");
+	BOOST_CHECK_EQUAL(map.values.size(), 1);
+	BOOST_CHECK_EQUAL(map.values.at(3), "b");
+	map.eraseKey(3);
+	BOOST_CHECK(map.values.empty());
+}
+
+BOOST_AUTO_TEST_CASE(changes_since_checkpoint)
+{
+	InvertibleMap<int, string> map;
+	map.set(1, "a");
+	map.set(2, "b");
+	size_t outer = map.checkpoint();
+	map.set(1, "c");
+	size_t inner = map.checkpoint();
+	map.set(1, "d");
+	map.eraseKey(2);
+	map.set(3, "e");
+
+	auto innerChanges = map.changedSince(inner);
+	BOOST_CHECK_EQUAL(innerChanges.size(), 3);
+	BOOST_CHECK_EQUAL(*innerChanges.at(1), "c");
+	BOOST_CHECK_EQUAL(*innerChanges.at(2), "b");
+	BOOST_CHECK(!innerChanges.at(3));
+	map.releaseCheckpoint(inner);
+
+	auto outerChanges = map.changedSince(outer);
+	BOOST_CHECK_EQUAL(outerChanges.size(), 3);
+	BOOST_CHECK_EQUAL(*outerChanges.at(1), "a");
+	map.releaseCheckpoint(outer);
+
+	map.clear();
+	BOOST_CHECK(map.changedSince(map.checkpoint()).empty());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}
+}
@@ -23,6 +23,8 @@
 
 #include <test/Options.h>
 
+#include <sstream>
+
 using namespace std;
 
 namespace dev
@@ -69,6 +71,68 @@ BOOST_AUTO_TEST_CASE(json_compact_print)
 	BOOST_CHECK("{\"1\":1,\"2\":\"2\",\"3\":{\"3.1\":\"3.1\",\"3.2\":2}}" == jsonCompactPrint(json));
 }
 
+BOOST_AUTO_TEST_CASE(json_object_writer)
+{
+	auto writeObject = [](JsonObjectWriter& _writer)
+	{
+		_writer.write("1", 1);
+		_writer.beginObject("2", true);
+		_writer.endObject();
+		_writer.beginObject("3");
+		_writer.beginObject("3.1", true);
+		_writer.write("3.1.1", "\"x\"");
+		_writer.endObject();
+		_writer.write("3.2", Json::arrayValue);
+		_writer.endObject();
+		_writer.beginObject("4");
+		_writer.beginObject("4.1");
+		_writer.finish();
+	};
+
+	Json::Value json;
+	JsonObjectWriter jsonWriter(json);
+	writeObject(jsonWriter);
+
+	ostringstream stream;
+	JsonObjectWriter streamWriter(stream);
+	writeObject(streamWriter);
+
+	string expectation = "{\"1\":1,\"3\":{\"3.1\":{\"3.1.1\":\"\\\"x\\\"\"},\"3.2\":[]},\"4\":{\"4.1\":{}}}";
+	BOOST_CHECK_EQUAL(jsonCompactPrint(json), expectation);
+	BOOST_CHECK_EQUAL(stream.str(), expectation);
+}
+
+BOOST_AUTO_TEST_CASE(json_object_writer_discard)
+{
+	Json::Value json;
+	JsonObjectWriter jsonWriter(json);
+	jsonWriter.write("1", 1);
+	jsonWriter.beginObject("2");
+	jsonWriter.write("2.1", 2);
+	BOOST_CHECK(jsonWriter.discard());
+	jsonWriter.write("3", 3);
+	jsonWriter.finish();
+	BOOST_CHECK_EQUAL(jsonCompactPrint(json), "{\"3\":3}");
+
+	ostringstream stream;
+	JsonObjectWriter streamWriter(stream);
+	streamWriter.beginObject("1", true);
+	BOOST_CHECK(stream.str().empty());
+	BOOST_CHECK(streamWriter.discard());
+	streamWriter.write("2", 2);
+	// Members are written to the stream right away and cannot be taken back.
+	BOOST_CHECK_EQUAL(stream.str(), "{\"2\":2");
+	BOOST_CHECK(!streamWriter.discard());
+	streamWriter.write("3", 3);
+	streamWriter.finish();
+	BOOST_CHECK_EQUAL(stream.str(), "{\"2\":2,\"3\":3}");
+
+	ostringstream emptyStream;
+	JsonObjectWriter emptyWriter(emptyStream);
+	emptyWriter.finish();
+	BOOST_CHECK_EQUAL(emptyStream.str(), "{}");
+}
+
 BOOST_AUTO_TEST_CASE(parse_json_not_strict)
 {
 	Json::Value json;
@@ -70,6 +70,35 @@ BOOST_AUTO_TEST_CASE(strings)
 	);
 }
 
+BOOST_AUTO_TEST_CASE(batch)
+{
+	BOOST_CHECK(keccak256Batch({}).empty());
+
+	// Lengths around the block boundaries of 136 bytes, with enough
+	// inputs of each number of blocks to fill several groups of lanes.
+	vector<bytes> inputs;
+	for (size_t length: {0, 1, 55, 135, 136, 137, 271, 272, 300})
+		for (size_t i = 0; i < 9; ++i)
+		{
+			bytes input(length);
+			for (size_t j = 0; j < length; ++j)
+				input[j] = uint8_t(i * 31 + j * 7 + length);
+			inputs.push_back(input);
+		}
+	vector<bytesConstRef> refs;
+	for (bytes const& input: inputs)
+		refs.emplace_back(&input);
+
+	vector<h256> hashes = keccak256Batch(refs);
+	BOOST_REQUIRE_EQUAL(hashes.size(), inputs.size());
+	for (size_t i = 0; i < inputs.size(); ++i)
+		BOOST_CHECK_EQUAL(hashes[i], keccak256(inputs[i]));
+	BOOST_CHECK_EQUAL(
+		keccak256Batch({bytesConstRef("test")}).front(),
+		FixedHash<32>("0x9c22ff5f21f0b81b113e63f7db6da94fedef11b2119b4088b89664fb9a3cb658")
+	);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 }
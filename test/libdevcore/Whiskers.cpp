@@ -194,6 +194,24 @@ BOOST_AUTO_TEST_CASE(invalid_param_rendered)
 	BOOST_CHECK_EQUAL(m.render(), templ);
 }
 
+BOOST_AUTO_TEST_CASE(unclosed_elements_rendered)
+{
+	string templ = "<#l>a</m> <?c>b<!c>c <x";
+	Whiskers m(templ);
+	BOOST_CHECK_EQUAL(m.render(), templ);
+}
+
+BOOST_AUTO_TEST_CASE(same_template_different_values)
+{
+	string templ = "<?c><a><!c>-</c><#l><b></l>";
+	vector<map<string, string>> list(2);
+	list[0]["b"] = "1";
+	list[1]["b"] = "2";
+	BOOST_CHECK_EQUAL(Whiskers(templ)("a", "x")("c", true)("l", list).render(), "x12");
+	list.pop_back();
+	BOOST_CHECK_EQUAL(Whiskers(templ)("a", "y")("c", false)("l", list).render(), "-1");
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 }
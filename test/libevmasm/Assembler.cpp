@@ -148,6 +148,65 @@ BOOST_AUTO_TEST_CASE(all_assembly_items)
 	);
 }
 
+BOOST_AUTO_TEST_CASE(sub_assembly_deduplication)
+{
+	auto source = make_shared<CharStream>("", "sub.asm");
+	auto createSub = [&](int _start)
+	{
+		auto sub = make_shared<Assembly>();
+		sub->setSourceLocation({_start, _start + 2, source});
+		sub->append(u256(1));
+		sub->append(Instruction::STOP);
+		return sub;
+	};
+
+	Assembly _assembly;
+	auto sub = createSub(1);
+	auto emptySub = make_shared<Assembly>();
+	BOOST_CHECK_EQUAL(_assembly.newSub(sub).data(), 0);
+	// The same assembly or one with the same content is re-used.
+	BOOST_CHECK_EQUAL(_assembly.newSub(sub).data(), 0);
+	BOOST_CHECK_EQUAL(_assembly.newSub(createSub(1)).data(), 0);
+	// Differing source locations result in differing source mappings.
+	BOOST_CHECK_EQUAL(_assembly.newSub(createSub(4)).data(), 1);
+	// Empty assemblies are only re-used if they are the same object.
+	BOOST_CHECK_EQUAL(_assembly.newSub(emptySub).data(), 2);
+	BOOST_CHECK_EQUAL(_assembly.newSub(make_shared<Assembly>()).data(), 3);
+	BOOST_CHECK_EQUAL(_assembly.newSub(emptySub).data(), 2);
+}
+
+BOOST_AUTO_TEST_CASE(shared_sub_assembly_optimised_again_after_modification)
+{
+	auto countAdds = [](Assembly const& _assembly)
+	{
+		return count(_assembly.items().begin(), _assembly.items().end(), AssemblyItem(Instruction::ADD));
+	};
+	auto appendStore = [](Assembly& _assembly, u256 _slot)
+	{
+		_assembly.append(u256(2));
+		_assembly.append(u256(1));
+		_assembly.append(Instruction::ADD);
+		_assembly.append(_slot);
+		_assembly.append(Instruction::SSTORE);
+	};
+
+	auto sub = make_shared<Assembly>();
+	appendStore(*sub, 0);
+	Assembly _assembly;
+	_assembly.appendSubroutine(sub);
+	_assembly.append(Instruction::STOP);
+
+	_assembly.optimise(true, EVMVersion(), true, 200);
+	BOOST_CHECK_EQUAL(countAdds(_assembly.sub(0)), 0);
+
+	// The modification of the sub-assembly is taken into account,
+	// although the assembly itself did not change.
+	appendStore(_assembly.sub(0), 1);
+	BOOST_CHECK_EQUAL(countAdds(_assembly.sub(0)), 1);
+	_assembly.optimise(true, EVMVersion(), true, 200);
+	BOOST_CHECK_EQUAL(countAdds(_assembly.sub(0)), 0);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 }
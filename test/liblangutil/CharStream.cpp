@@ -47,6 +47,19 @@ BOOST_AUTO_TEST_CASE(test_fail)
 	);
 }
 
+BOOST_AUTO_TEST_CASE(shared_source)
+{
+	auto const buffer = std::make_shared<std::string const>("contract C {}");
+	CharStream source(buffer, "source");
+	CharStream copy = source;
+
+	BOOST_CHECK(source.sharedSource() == buffer);
+	BOOST_CHECK(&copy.source() == buffer.get());
+	BOOST_CHECK('c' == copy.get());
+	BOOST_CHECK('o' == source.advanceAndGet());
+	BOOST_CHECK('c' == copy.get());
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 }
@@ -0,0 +1,183 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+/**
+ * Unit tests for the SMT solver portfolio and the cache of solver answers.
+ */
+
+#include <libsolidity/formal/SMTPortfolio.h>
+#include <libsolidity/interface/CompilerStack.h>
+
+#include <libdevcore/Keccak256.h>
+
+#include <boost/test/unit_test.hpp>
+
+#include <functional>
+#include <string>
+
+using namespace std;
+
+namespace dev
+{
+namespace solidity
+{
+namespace test
+{
+
+namespace
+{
+
+/// Declares the variable x and asserts x > 2.
+smt::Expression declareX(smt::SolverInterface& _solver)
+{
+	smt::Expression x = _solver.newVariable("x", make_shared<smt::Sort>(smt::Kind::Int));
+	_solver.addAssertion(x > 2);
+	return x;
+}
+
+/// Answers all @a _queries with @a _answer in @a _responses.
+void answer(map<h256, string>& _responses, vector<string> const& _queries, smt::CheckResult _answer)
+{
+	for (string const& query: _queries)
+		_responses[keccak256(query)] = _answer == smt::CheckResult::UNSATISFIABLE ? "unsat\n" : "sat\n";
+}
+
+}
+
+BOOST_AUTO_TEST_SUITE(SMTPortfolioTest)
+
+BOOST_AUTO_TEST_CASE(repeated_query_uses_cache)
+{
+	smt::QueryCache cache;
+	map<h256, string> responses;
+	vector<string> queries;
+	{
+		smt::SMTPortfolio solver(responses, cache);
+		smt::Expression x = declareX(solver);
+		solver.checkAssuming({x < 1}, {});
+		queries = solver.unhandledQueries();
+	}
+	BOOST_REQUIRE_EQUAL(queries.size(), 1);
+	answer(responses, queries, smt::CheckResult::UNSATISFIABLE);
+	{
+		smt::SMTPortfolio solver(responses, cache);
+		smt::Expression x = declareX(solver);
+		BOOST_CHECK(solver.checkAssuming({x < 1}, {}).first == smt::CheckResult::UNSATISFIABLE);
+		BOOST_CHECK(solver.unhandledQueries().empty());
+	}
+	BOOST_CHECK_EQUAL(cache.size(), 1);
+
+	// Without a response, the answer can only come from the cache.
+	responses.clear();
+	smt::SMTPortfolio solver(responses, cache);
+	smt::Expression x = declareX(solver);
+	BOOST_CHECK(solver.checkAssuming({x < 1}, {}).first == smt::CheckResult::UNSATISFIABLE);
+	BOOST_CHECK(solver.unhandledQueries().empty());
+	// A different query is not answered from the cache.
+	solver.checkAssuming({x < 2}, {});
+	BOOST_CHECK_EQUAL(solver.unhandledQueries().size(), 1);
+}
+
+BOOST_AUTO_TEST_CASE(assumptions_agree_with_push_and_pop)
+{
+	vector<pair<function<smt::Expression(smt::Expression)>, smt::CheckResult>> const cases{
+		{[](smt::Expression _x) { return _x < 1; }, smt::CheckResult::UNSATISFIABLE},
+		{[](smt::Expression _x) { return _x > 5; }, smt::CheckResult::SATISFIABLE},
+		{[](smt::Expression _x) { return _x > 5 && _x < 3; }, smt::CheckResult::UNSATISFIABLE}
+	};
+
+	// Answer the queries the way they are sent if the assumptions are asserted
+	// in a temporary context.
+	map<h256, string> responses;
+	for (auto const& testCase: cases)
+	{
+		smt::QueryCache cache;
+		smt::SMTPortfolio solver(responses, cache);
+		smt::Expression x = declareX(solver);
+		solver.push();
+		solver.addAssertion(testCase.first(x));
+		solver.check({});
+		solver.pop();
+		answer(responses, solver.unhandledQueries(), testCase.second);
+	}
+
+	for (auto const& testCase: cases)
+	{
+		smt::QueryCache cache;
+		smt::SMTPortfolio pushPopSolver(responses, cache);
+		smt::Expression x = declareX(pushPopSolver);
+		pushPopSolver.push();
+		pushPopSolver.addAssertion(testCase.first(x));
+		BOOST_CHECK(pushPopSolver.check({}).first == testCase.second);
+		pushPopSolver.pop();
+		BOOST_CHECK(pushPopSolver.unhandledQueries().empty());
+
+		smt::QueryCache assumptionCache;
+		smt::SMTPortfolio assumptionSolver(responses, assumptionCache);
+		x = declareX(assumptionSolver);
+		BOOST_CHECK(assumptionSolver.checkAssuming({testCase.first(x)}, {}).first == testCase.second);
+		BOOST_CHECK(assumptionSolver.unhandledQueries().empty());
+		// Both queries are identified by the same key.
+		BOOST_CHECK(cache == assumptionCache);
+	}
+}
+
+BOOST_AUTO_TEST_CASE(compiler_stack_cache_cleared_on_reset)
+{
+	string const source = R"(
+		pragma experimental SMTChecker;
+		contract C {
+			function f(uint x) public pure {
+				require(x > 2);
+				assert(x > 1);
+			}
+		}
+	)";
+	CompilerStack compiler;
+	auto analyse = [&](map<h256, string> const& _responses) -> vector<string>
+	{
+		compiler.setSources({{"", source}});
+		for (auto const& response: _responses)
+			compiler.addSMTLib2Response(response.first, response.second);
+		BOOST_REQUIRE(compiler.parseAndAnalyze());
+		return compiler.unhandledSMTLib2Queries();
+	};
+
+	vector<string> queries = analyse({});
+	BOOST_REQUIRE(!queries.empty());
+	map<h256, string> responses;
+	// Answering some queries might lead to new ones.
+	for (size_t i = 0; i < 10 && !queries.empty(); ++i)
+	{
+		answer(responses, queries, smt::CheckResult::UNSATISFIABLE);
+		compiler.reset(true);
+		queries = analyse(responses);
+	}
+	BOOST_REQUIRE(queries.empty());
+
+	// The responses are cleared on reset, but the answers are cached.
+	compiler.reset(true);
+	BOOST_CHECK(analyse({}).empty());
+
+	compiler.reset(false);
+	BOOST_CHECK(!analyse({}).empty());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}
+}
+}
@@ -671,6 +671,34 @@ BOOST_AUTO_TEST_CASE(inline_asm_end_location)
 	BOOST_CHECK_MESSAGE(visitor.visited, "No inline asm block found?!");
 }
 
+BOOST_AUTO_TEST_CASE(interned_identifiers)
+{
+	char const* text = R"(
+		contract C {
+			function f(uint value) public pure returns (uint) {
+				return value + value;
+			}
+		}
+	)";
+	ErrorList errors;
+	// The source unit is already destroyed, the contract has to keep the arena alive.
+	ASTPointer<ContractDefinition> contract = parseText(text, errors);
+	BOOST_REQUIRE(contract);
+	FunctionDefinition const* function = contract->definedFunctions().at(0);
+	VariableDeclaration const& parameter = *function->parameters().at(0);
+	auto const& returnStatement = dynamic_cast<Return const&>(*function->body().statements().at(0));
+	auto const& sum = dynamic_cast<BinaryOperation const&>(*returnStatement.expression());
+	auto const& left = dynamic_cast<Identifier const&>(sum.leftExpression());
+	auto const& right = dynamic_cast<Identifier const&>(sum.rightExpression());
+	BOOST_CHECK_EQUAL(parameter.name(), "value");
+	BOOST_CHECK_EQUAL(&left.name(), &parameter.name());
+	BOOST_CHECK_EQUAL(&right.name(), &parameter.name());
+	// Annotations are created in the arena on demand.
+	left.annotation().isPure = true;
+	BOOST_CHECK(left.annotation().isPure);
+	BOOST_CHECK(!right.annotation().isPure);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 }
@@ -648,6 +648,36 @@ BOOST_AUTO_TEST_CASE(irregular_line_breaks_in_strings)
 	}
 }
 
+BOOST_AUTO_TEST_CASE(long_runs)
+{
+	// Runs longer than a block of characters that are classified at once.
+	string identifier = "identifier_$" + string(40, 'x') + "0123456789";
+	string text = "string with 'quotes' \\\" and escapes" + string(40, ' ');
+	Scanner scanner(CharStream(
+		string(37, ' ') + "\t\r\n" + identifier + " /*" + string(50, '*') + " */ \"" + text + "\"" +
+		"// comment" + string(50, '-') + "\n/// doc" + string(20, '/') + "\n" + identifier,
+		""
+	));
+	BOOST_CHECK_EQUAL(scanner.currentToken(), Token::Identifier);
+	BOOST_CHECK_EQUAL(scanner.currentLiteral(), identifier);
+	BOOST_CHECK_EQUAL(scanner.next(), Token::StringLiteral);
+	BOOST_CHECK_EQUAL(scanner.currentLiteral(), "string with 'quotes' \" and escapes" + string(40, ' '));
+	BOOST_CHECK_EQUAL(scanner.next(), Token::Identifier);
+	BOOST_CHECK_EQUAL(scanner.currentLiteral(), identifier);
+	BOOST_CHECK_EQUAL(scanner.currentCommentLiteral(), "doc" + string(20, '/'));
+	BOOST_CHECK_EQUAL(scanner.next(), Token::EOS);
+}
+
+BOOST_AUTO_TEST_CASE(non_line_break_multibyte_characters_in_comments)
+{
+	// These start with the same bytes as unicode line breaks.
+	Scanner scanner(CharStream("// a \xC2\xA0 b \xE2\x80\x80 c\n/// d \xE2\x82\xAC e\nf", ""));
+	BOOST_CHECK_EQUAL(scanner.currentToken(), Token::Identifier);
+	BOOST_CHECK_EQUAL(scanner.currentCommentLiteral(), "d \xE2\x82\xAC e");
+	BOOST_CHECK_EQUAL(scanner.currentLiteral(), "f");
+	BOOST_CHECK_EQUAL(scanner.next(), Token::EOS);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 }
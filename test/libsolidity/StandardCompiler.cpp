@@ -1104,6 +1104,44 @@ BOOST_AUTO_TEST_CASE(metadata_without_compilation)
 	BOOST_CHECK(dev::test::isValidMetadata(contract["metadata"].asString()));
 }
 
+BOOST_AUTO_TEST_CASE(abi_without_compilation_of_other_contract)
+{
+	// NOTE: the contract A here should fail to compile due to "out of stack"
+	// If no error is returned, that means only B was compiled.
+	char const* input = R"(
+	{
+		"language": "Solidity",
+		"settings": {
+			"outputSelection": {
+				"fileA": { "A": [ "abi" ], "B": [ "evm.bytecode.object" ] }
+			}
+		},
+		"sources": {
+			"fileA": {
+				"content": "contract A {
+  function x(uint a, uint b, uint c, uint d, uint e, uint f, uint g, uint h, uint i, uint j, uint k, uint l, uint m, uint n, uint o, uint p) pure public {}
+  function y() pure public {
+    uint a; uint b; uint c; uint d; uint e; uint f; uint g; uint h; uint i; uint j; uint k; uint l; uint m; uint n; uint o; uint p;
+    x(a, b, c, d, e, f, g, h, i, j, k, l, m, n, o, p);
+  }
+}
+contract B { }"
+			}
+		}
+	}
+	)";
+	Json::Value result = compile(input);
+	BOOST_CHECK(containsAtMostWarnings(result));
+	Json::Value contract = getContractResult(result, "fileA", "A");
+	BOOST_CHECK(contract.isObject());
+	BOOST_CHECK(contract["abi"].isArray());
+	BOOST_CHECK(!contract.isMember("evm"));
+	contract = getContractResult(result, "fileA", "B");
+	BOOST_CHECK(contract.isObject());
+	BOOST_CHECK(contract["evm"]["bytecode"]["object"].isString());
+	BOOST_CHECK(!contract["evm"]["bytecode"]["object"].asString().empty());
+}
+
 BOOST_AUTO_TEST_CASE(common_pattern)
 {
 	char const* input = R"(
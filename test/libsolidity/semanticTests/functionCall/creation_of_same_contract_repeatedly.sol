@@ -0,0 +1,21 @@
+contract C {
+    uint public x;
+    constructor(uint _x) public {
+        x = _x;
+    }
+}
+contract D {
+    function f() public returns (uint) {
+        return (new C(7)).x();
+    }
+}
+contract E {
+    function f() public returns (uint, uint, uint) {
+        C a = new C(1);
+        C b = new C(2);
+        D d = new D();
+        return (a.x(), b.x(), d.f());
+    }
+}
+// ----
+// f() -> 1, 2, 7
@@ -0,0 +1,19 @@
+library L {
+	function f(uint self) internal pure returns (uint) { return self; }
+	function f(uint self, uint x) internal pure returns (uint) { return self + x; }
+	function g(bytes32 self) internal pure returns (bytes32) { return self; }
+}
+contract A {
+	using L for uint;
+}
+contract C is A {
+	using L for *;
+	function h(uint a, bytes32 b) public pure returns (uint, bytes32) {
+		return (a.f() + a.f(2), b.g());
+	}
+	function i(bool c) public pure {
+		c.f();
+	}
+}
+// ----
+// TypeError: (449-452): Member "f" not found or not visible after argument-dependent lookup in bool.
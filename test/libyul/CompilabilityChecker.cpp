@@ -35,16 +35,27 @@ namespace test
 
 namespace
 {
-string check(string const& _input)
+string toString(map<YulString, int> const& _functions)
 {
-	shared_ptr<Block> ast = yul::test::parse(_input, false).first;
-	BOOST_REQUIRE(ast);
-	map<YulString, int> functions = CompilabilityChecker::run(EVMDialect::strictAssemblyForEVM(dev::test::Options::get().evmVersion()), *ast, true);
 	string out;
-	for (auto const& function: functions)
+	for (auto const& function: _functions)
 		out += function.first.str() + ": " + to_string(function.second) + " ";
 	return out;
 }
+
+string check(string const& _input)
+{
+	shared_ptr<Block> ast = yul::test::parse(_input, false).first;
+	BOOST_REQUIRE(ast);
+	return toString(CompilabilityChecker::run(EVMDialect::strictAssemblyForEVM(dev::test::Options::get().evmVersion()), *ast, true));
+}
+
+string check(string const& _input, set<YulString> const& _functions)
+{
+	shared_ptr<Block> ast = yul::test::parse(_input, false).first;
+	BOOST_REQUIRE(ast);
+	return toString(CompilabilityChecker::run(EVMDialect::strictAssemblyForEVM(dev::test::Options::get().evmVersion()), *ast, true, _functions));
+}
 }
 
 BOOST_AUTO_TEST_SUITE(CompilabilityChecker)
@@ -219,6 +230,62 @@ BOOST_AUTO_TEST_CASE(also_in_outer_block)
 	BOOST_CHECK_EQUAL(out, ": 9 ");
 }
 
+BOOST_AUTO_TEST_CASE(selected_functions)
+{
+	string code = R"({
+		{
+			let x := 0
+			let r1 := 0
+			let r2 := 0
+			let r3 := 0
+			let r4 := 0
+			let r5 := 0
+			let r6 := 0
+			let r7 := 0
+			let r8 := 0
+			let r9 := 0
+			let r10 := 0
+			let r11 := 0
+			let r12 := 0
+			let r13 := 0
+			let r14 := 0
+			let r15 := 0
+			let r16 := 0
+			let r17 := 0
+			let r18 := 0
+			x := add(add(add(add(add(add(add(add(add(add(add(add(x, r12), r11), r10), r9), r8), r7), r6), r5), r4), r3), r2), r1)
+			sstore(0, h(x))
+		}
+		function f(a, b) -> r1, r2, r3, r4, r5, r6, r7, r8, r9, r10, r11, r12, r13, r14, r15, r16, r17, r18, r19 {
+		}
+		function h(x) -> y {
+			let r1 := 0
+			let r2 := 0
+			let r3 := 0
+			let r4 := 0
+			let r5 := 0
+			let r6 := 0
+			let r7 := 0
+			let r8 := 0
+			let r9 := 0
+			let r10 := 0
+			let r11 := 0
+			let r12 := 0
+			let r13 := 0
+			let r14 := 0
+			let r15 := 0
+			let r16 := 0
+			let r17 := 0
+			let r18 := 0
+			y := add(add(add(add(add(add(add(add(add(add(add(add(x, r12), r11), r10), r9), r8), r7), r6), r5), r4), r3), r2), r1)
+		}
+	})";
+	BOOST_CHECK_EQUAL(check(code, {}), "");
+	BOOST_CHECK_EQUAL(check(code, {YulString{"f"}}), "f: 5 ");
+	BOOST_CHECK_EQUAL(check(code, {YulString{"h"}}), "h: 10 ");
+	BOOST_CHECK_EQUAL(check(code, {YulString{}, YulString{"h"}}), ": 9 ");
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 }
@@ -24,10 +24,12 @@
 #include <test/libsolidity/ErrorCheck.h>
 #include <test/libyul/Common.h>
 
+#include <libyul/AsmData.h>
 #include <libyul/AsmParser.h>
 #include <libyul/AsmAnalysis.h>
 #include <libyul/AsmAnalysisInfo.h>
 #include <libyul/Dialect.h>
+#include <libyul/optimiser/ASTCopier.h>
 #include <liblangutil/Scanner.h>
 #include <liblangutil/ErrorReporter.h>
 
@@ -574,6 +576,47 @@ BOOST_AUTO_TEST_CASE(builtins_analysis)
 	CHECK_ERROR_DIALECT("{ let a, b := builtin(1, 2) }", DeclarationError, "Variable count mismatch: 2 variables and 3 values.", dialect);
 }
 
+BOOST_AUTO_TEST_CASE(node_locations)
+{
+	ErrorList errors;
+	ErrorReporter errorReporter(errors);
+	auto scanner = make_shared<Scanner>(CharStream("{ let x:u256 := 1:u256 x := 2:u256 }", "source"));
+	shared_ptr<Block> block = yul::Parser(errorReporter, Dialect::yul()).parse(scanner, false);
+	BOOST_REQUIRE(block);
+	BOOST_REQUIRE_EQUAL(block->statements.size(), 2);
+	BOOST_CHECK_EQUAL(block->location.start(), 0);
+	BOOST_CHECK_EQUAL(block->location.end(), 36);
+	BOOST_CHECK_EQUAL(block->location.get().source->name(), "source");
+	auto const& varDecl = boost::get<VariableDeclaration>(block->statements[0]);
+	BOOST_CHECK_EQUAL(varDecl.location.start(), 2);
+	BOOST_CHECK_EQUAL(varDecl.location.end(), 22);
+	auto const& assignment = boost::get<Assignment>(block->statements[1]);
+	BOOST_CHECK_EQUAL(assignment.location.start(), 23);
+	BOOST_CHECK_EQUAL(assignment.location.end(), 34);
+	// Equal locations share their handle.
+	BOOST_CHECK(varDecl.variables.front().location == YulLocation(langutil::SourceLocation{6, 12, scanner->charStream()}));
+	BOOST_CHECK(varDecl.variables.front().location != assignment.variableNames.front().location);
+}
+
+BOOST_AUTO_TEST_CASE(node_locations_keep_source_until_reset)
+{
+	ErrorList errors;
+	ErrorReporter errorReporter(errors);
+	auto scanner = make_shared<Scanner>(CharStream("{ }", "source"));
+	shared_ptr<Block> block = yul::Parser(errorReporter, Dialect::yul()).parse(scanner, false);
+	BOOST_REQUIRE(block);
+	weak_ptr<CharStream> source = scanner->charStream();
+	// Copies of the AST do not refer to the parsed block.
+	Block copy = boost::get<Block>(ASTCopier{}(*block));
+	scanner.reset();
+	block.reset();
+	BOOST_REQUIRE(!source.expired());
+	BOOST_CHECK(copy.location.get().source == source.lock());
+	BOOST_CHECK_EQUAL(copy.location.end(), 3);
+	YulStringRepository::reset();
+	BOOST_CHECK(source.expired());
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 }
@@ -72,7 +72,7 @@ BOOST_AUTO_TEST_CASE(single_var_assigned_plus_code)
 BOOST_AUTO_TEST_CASE(single_var_assigned_plus_code_and_reused)
 {
 	string out = assemble("{ let x := 1 mstore(3, 4) pop(mload(x)) }");
-	BOOST_CHECK_EQUAL(out, "PUSH1 0x1 PUSH1 0x4 PUSH1 0x3 MSTORE DUP1 MLOAD POP POP ");
+	BOOST_CHECK_EQUAL(out, "PUSH1 0x1 PUSH1 0x4 PUSH1 0x3 MSTORE MLOAD POP ");
 }
 
 BOOST_AUTO_TEST_CASE(multi_reuse_single_slot)
@@ -92,7 +92,7 @@ BOOST_AUTO_TEST_CASE(multi_reuse_same_variable_name)
 	string out = assemble("{ let z := mload(0) { let x := 1 x := 6 z := x } { let x := 2 z := x x := 4 } }");
 	BOOST_CHECK_EQUAL(out,
 		"PUSH1 0x0 MLOAD "
-		"PUSH1 0x1 PUSH1 0x6 SWAP1 POP DUP1 SWAP2 POP POP "
+		"PUSH1 0x1 PUSH1 0x6 SWAP1 POP SWAP1 POP "
 		"PUSH1 0x2 DUP1 SWAP2 POP PUSH1 0x4 SWAP1 POP POP "
 		"POP "
 	);
@@ -104,6 +104,27 @@ BOOST_AUTO_TEST_CASE(last_use_in_nested_block)
 	BOOST_CHECK_EQUAL(out, "PUSH1 0x0 DUP1 POP POP PUSH1 0x1 POP ");
 }
 
+BOOST_AUTO_TEST_CASE(if_last_use)
+{
+	// The slot of z is used as the condition in place.
+	string out = assemble("{ let z := mload(0) if z { sstore(0, 1) } }");
+	BOOST_CHECK_EQUAL(out, "PUSH1 0x0 MLOAD ISZERO PUSH1 0xC JUMPI PUSH1 0x1 PUSH1 0x0 SSTORE JUMPDEST ");
+}
+
+BOOST_AUTO_TEST_CASE(if_last_use_above_unused_slot)
+{
+	// The slot of y cannot be used in place, because the unused slot of x
+	// would end up on top of the stack inside the body.
+	string out = assemble("{ let x := mload(0) let y := add(x, 1) if y { sstore(0, 1) } }");
+	BOOST_CHECK_EQUAL(out,
+		"PUSH1 0x0 MLOAD "
+		"PUSH1 0x1 DUP2 ADD "
+		"DUP1 ISZERO PUSH1 0x11 JUMPI "
+		"PUSH1 0x1 PUSH1 0x0 SSTORE "
+		"JUMPDEST POP POP "
+	);
+}
+
 BOOST_AUTO_TEST_CASE(if_)
 {
 	// z is only removed after the if (after the jumpdest)
@@ -124,6 +145,19 @@ BOOST_AUTO_TEST_CASE(switch_)
 	);
 }
 
+BOOST_AUTO_TEST_CASE(switch_last_use)
+{
+	// The slot of z is used as the switch condition.
+	string out = assemble("{ let z := calldataload(0) switch z case 0 { sstore(0, 1) } }");
+	BOOST_CHECK_EQUAL(out,
+		"PUSH1 0x0 CALLDATALOAD "
+		"PUSH1 0x0 DUP2 EQ PUSH1 0xD JUMPI "
+		"PUSH1 0x13 JUMP "
+		"JUMPDEST PUSH1 0x1 PUSH1 0x0 SSTORE "
+		"JUMPDEST POP "
+	);
+}
+
 BOOST_AUTO_TEST_CASE(reuse_slots)
 {
 	// x and y should reuse the slots of b and d
@@ -337,8 +371,8 @@ BOOST_AUTO_TEST_CASE(reuse_slots_function_with_gaps)
 		// stack: d c x3 a b
 		"POP "
 		// stack: d c x3 a
-		"DUP1 DUP3 MSTORE "
-		"POP POP "
+		"DUP2 MSTORE " // a is used in place
+		"POP "
 		// stack: d c
 		"DUP2 DUP2 MSTORE "
 		"POP POP "
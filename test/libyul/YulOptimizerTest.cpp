@@ -148,7 +148,7 @@ TestCase::TestResult YulOptimizerTest::run(ostream& _stream, string const& _line
 	else if (m_optimizerStep == "commonSubexpressionEliminator")
 	{
 		disambiguate();
-		(CommonSubexpressionEliminator{*m_dialect})(*m_ast);
+		CommonSubexpressionEliminator::run(*m_dialect, *m_ast);
 	}
 	else if (m_optimizerStep == "expressionSplitter")
 	{
@@ -190,7 +190,10 @@ TestCase::TestResult YulOptimizerTest::run(ostream& _stream, string const& _line
 		(FunctionGrouper{})(*m_ast);
 		NameDispenser nameDispenser{*m_dialect, *m_ast};
 		ExpressionSplitter{*m_dialect, nameDispenser}(*m_ast);
-		FullInliner(*m_ast, nameDispenser).run();
+		unique_ptr<GasMeter> meter;
+		if (auto const* evmDialect = dynamic_cast<EVMDialect const*>(m_dialect))
+			meter = make_unique<GasMeter>(*evmDialect, false, 200);
+		FullInliner(*m_ast, nameDispenser, meter.get()).run();
 		ExpressionJoiner::run(*m_ast);
 	}
 	else if (m_optimizerStep == "mainFunction")
@@ -217,10 +220,10 @@ TestCase::TestResult YulOptimizerTest::run(ostream& _stream, string const& _line
 		NameDispenser nameDispenser{*m_dialect, *m_ast};
 		ExpressionSplitter{*m_dialect, nameDispenser}(*m_ast);
 		ForLoopInitRewriter{}(*m_ast);
-		CommonSubexpressionEliminator{*m_dialect}(*m_ast);
+		CommonSubexpressionEliminator::run(*m_dialect, *m_ast);
 		ExpressionSimplifier::run(*m_dialect, *m_ast);
 		UnusedPruner::runUntilStabilised(*m_dialect, *m_ast);
-		DeadCodeEliminator{*m_dialect}(*m_ast);
+		DeadCodeEliminator::run(*m_dialect, *m_ast);
 		ExpressionJoiner::run(*m_ast);
 		ExpressionJoiner::run(*m_ast);
 	}
@@ -233,7 +236,7 @@ TestCase::TestResult YulOptimizerTest::run(ostream& _stream, string const& _line
 	{
 		disambiguate();
 		ForLoopInitRewriter{}(*m_ast);
-		DeadCodeEliminator{*m_dialect}(*m_ast);
+		DeadCodeEliminator::run(*m_dialect, *m_ast);
 	}
 	else if (m_optimizerStep == "ssaTransform")
 	{
@@ -259,7 +262,7 @@ TestCase::TestResult YulOptimizerTest::run(ostream& _stream, string const& _line
 		ForLoopInitRewriter{}(*m_ast);
 		NameDispenser nameDispenser{*m_dialect, *m_ast};
 		ExpressionSplitter{*m_dialect, nameDispenser}(*m_ast);
-		CommonSubexpressionEliminator{*m_dialect}(*m_ast);
+		CommonSubexpressionEliminator::run(*m_dialect, *m_ast);
 		ExpressionSimplifier::run(*m_dialect, *m_ast);
 
 		LoadResolver::run(*m_dialect, *m_ast);
@@ -297,7 +300,7 @@ TestCase::TestResult YulOptimizerTest::run(ostream& _stream, string const& _line
 		RedundantAssignEliminator::run(*m_dialect, *m_ast);
 		// reverse SSA
 		SSAReverser::run(*m_ast);
-		CommonSubexpressionEliminator{*m_dialect}(*m_ast);
+		CommonSubexpressionEliminator::run(*m_dialect, *m_ast);
 		UnusedPruner::runUntilStabilised(*m_dialect, *m_ast);
 	}
 	else if (m_optimizerStep == "stackCompressor")
@@ -399,7 +402,7 @@ bool YulOptimizerTest::parse(ostream& _stream, string const& _linePrefix, bool c
 
 void YulOptimizerTest::disambiguate()
 {
-	*m_ast = boost::get<Block>(Disambiguator(*m_dialect, *m_analysisInfo)(*m_ast));
+	Disambiguator::run(*m_dialect, *m_ast, *m_analysisInfo);
 	m_analysisInfo.reset();
 }
 
@@ -0,0 +1,54 @@
+/*
+    This file is part of solidity.
+
+    solidity is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    solidity is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+/**
+ * Unit tests for the Yul string repository.
+ */
+
+#include <test/Options.h>
+
+#include <libyul/YulString.h>
+
+using namespace std;
+
+namespace yul
+{
+namespace test
+{
+
+BOOST_AUTO_TEST_SUITE(YulStringTest)
+
+BOOST_AUTO_TEST_CASE(contains_empty_string)
+{
+	BOOST_CHECK(YulStringRepository::instance().contains(""));
+}
+
+BOOST_AUTO_TEST_CASE(contains_does_not_store)
+{
+	string const name = "yul_string_test_contains_does_not_store";
+	YulStringRepository const& repository = YulStringRepository::instance();
+	BOOST_CHECK(!repository.contains(name));
+	// A second query would succeed if the first one had stored the string.
+	BOOST_CHECK(!repository.contains(name));
+	YulString stored{name};
+	BOOST_CHECK(repository.contains(name));
+	BOOST_CHECK(stored.str() == name);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}
+}
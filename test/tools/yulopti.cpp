@@ -123,7 +123,7 @@ public:
 				return;
 			if (!disambiguated)
 			{
-				*m_ast = boost::get<yul::Block>(Disambiguator(m_dialect, *m_analysisInfo)(*m_ast));
+				Disambiguator::run(m_dialect, *m_ast, *m_analysisInfo);
 				m_analysisInfo.reset();
 				m_nameDispenser = make_shared<NameDispenser>(m_dialect, *m_ast);
 				disambiguated = true;
@@ -150,7 +150,7 @@ public:
 				ForLoopConditionIntoBody{}(*m_ast);
 				break;
 			case 'c':
-				(CommonSubexpressionEliminator{m_dialect})(*m_ast);
+				CommonSubexpressionEliminator::run(m_dialect, *m_ast);
 				break;
 			case 'd':
 				(VarDeclInitializer{})(*m_ast);
@@ -189,7 +189,7 @@ public:
 				UnusedPruner::runUntilStabilised(m_dialect, *m_ast);
 				break;
 			case 'D':
-				DeadCodeEliminator{m_dialect}(*m_ast);
+				DeadCodeEliminator::run(m_dialect, *m_ast);
 				break;
 			case 'a':
 				SSATransform::run(*m_ast, *m_nameDispenser);